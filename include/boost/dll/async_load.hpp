@@ -0,0 +1,129 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_ASYNC_LOAD_HPP
+#define BOOST_DLL_ASYNC_LOAD_HPP
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/shared_library.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <future>
+#include <memory>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+/// \file boost/dll/async_load.hpp
+/// \brief Contains the boost::dll::async_load functions that load libraries without blocking the caller.
+
+namespace boost { namespace dll {
+
+/// @cond
+namespace detail {
+
+    // Task of the async_load() with a completion handler
+    template <class Handler>
+    struct async_load_task {
+        boost::dll::fs::path    lib_path;
+        load_mode::type         mode;
+        Handler                 handler;
+
+        void operator()() {
+            std::error_code ec;
+            shared_library lib(lib_path, mode, ec);
+            handler(ec, std::move(lib));
+        }
+    };
+
+} // namespace detail
+/// @endcond
+
+/*!
+* Loads the library on a separate thread.
+*
+* Loading of the library may take a long time, because it runs the static constructors of the library and processes
+* the relocations. This function returns immediately and does the loading in the background.
+*
+* \b Example:
+* \code
+* std::future<boost::dll::shared_library> f = boost::dll::async_load("plugins/libcompression.so");
+* // ... do some other work ...
+* boost::dll::shared_library lib = f.get();
+* \endcode
+*
+* \param lib_path Library file name, same as for shared_library::load().
+* \param mode A mode that will be used on library load.
+* \return Future with the loaded library. Future's get() throws \forcedlinkfs{system_error} if the library could not
+*       be loaded.
+* \throws std::system_error if the thread could not be started, std::bad_alloc in case of insufficient memory.
+*/
+inline std::future<shared_library> async_load(const boost::dll::fs::path& lib_path, load_mode::type mode = load_mode::default_mode) {
+    return std::async(std::launch::async, [lib_path, mode]() {
+        return shared_library(lib_path, mode);
+    });
+}
+
+/*!
+* Loads the library by a task that is submitted to the `executor`.
+*
+* \param lib_path Library file name, same as for shared_library::load().
+* \param mode A mode that will be used on library load.
+* \param executor Callable that accepts a nullary callable object and runs it, for example on a thread pool. The
+*       submitted callable is copy constructible.
+* \return Future with the loaded library. Future's get() throws \forcedlinkfs{system_error} if the library could not
+*       be loaded.
+* \throws std::bad_alloc in case of insufficient memory and anything that the `executor` throws.
+*/
+template <class Executor>
+std::future<shared_library> async_load(const boost::dll::fs::path& lib_path, load_mode::type mode, Executor&& executor) {
+    // std::packaged_task is move only, while many executors require copy constructible tasks
+    auto task = std::make_shared<std::packaged_task<shared_library()>>([lib_path, mode]() {
+        return shared_library(lib_path, mode);
+    });
+    std::future<shared_library> result = task->get_future();
+    executor([task]() { (*task)(); });
+    return result;
+}
+
+/*!
+* Loads the library by a task that is submitted to the `executor` and invokes the completion handler with the
+* result of loading. Handler is invoked on the thread that runs the task.
+*
+* \b Example:
+* \code
+* boost::dll::async_load("plugins/libcompression.so", boost::dll::load_mode::append_decorations,
+*     [&pool](std::function<void()> task) { pool.post(std::move(task)); },
+*     [](std::error_code ec, boost::dll::shared_library lib) {
+*         if (!ec) {
+*             register_plugin(std::move(lib));
+*         }
+*     }
+* );
+* \endcode
+*
+* \param lib_path Library file name, same as for shared_library::load().
+* \param mode A mode that will be used on library load.
+* \param executor Callable that accepts a nullary callable object and runs it, for example on a thread pool. The
+*       submitted callable is copy constructible if the `handler` is copy constructible.
+* \param handler Callable with the `void(std::error_code ec, boost::dll::shared_library lib)` signature. `ec` is set
+*       to the same value as in the shared_library::load(const boost::dll::fs::path&, load_mode::type, std::error_code&),
+*       `lib` is empty if `ec` is set.
+* \throws std::bad_alloc in case of insufficient memory and anything that the `executor` throws.
+*/
+template <class Executor, class Handler>
+void async_load(const boost::dll::fs::path& lib_path, load_mode::type mode, Executor&& executor, Handler&& handler) {
+    executor(boost::dll::detail::async_load_task<typename std::decay<Handler>::type>{
+        lib_path, mode, std::forward<Handler>(handler)
+    });
+}
+
+}} // namespace boost::dll
+
+#endif // BOOST_DLL_ASYNC_LOAD_HPP
@@ -0,0 +1,62 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_BINARY_READER_HPP
+#define BOOST_DLL_BINARY_READER_HPP
+
+#include <boost/dll/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstddef>
+#include <cstdint>
+
+/// \file boost/dll/binary_reader.hpp
+/// \brief Contains the boost::dll::binary_reader interface for providing binaries to
+/// the boost::dll::library_info from custom sources.
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Interface for random access reading of a binary from a custom source, for example
+* from an archive or from a network cache.
+*
+* \b Example:
+* \code
+* class archive_entry_reader: public boost::dll::binary_reader {
+*     // ...
+* public:
+*     std::uint64_t size() const override { return entry_.size(); }
+*     void read(std::uint64_t offset, char* buffer, std::size_t size) override { entry_.copy(offset, buffer, size); }
+* };
+*
+* archive_entry_reader reader(archive, "plugins/libmy_plugin.so");
+* boost::dll::library_info info(reader);
+* \endcode
+*/
+class binary_reader {
+public:
+    virtual ~binary_reader() = default;
+
+    /*!
+    * \return Size of the binary in bytes.
+    * \throws std::exception based exceptions.
+    */
+    virtual std::uint64_t size() const = 0;
+
+    /*!
+    * Copies `size` bytes starting from `offset` into the `buffer`.
+    * The requested range is always within the [0, size()) range.
+    * \throws std::exception based exceptions if the bytes could not be read.
+    */
+    virtual void read(std::uint64_t offset, char* buffer, std::size_t size) = 0;
+};
+
+}} // namespace boost::dll
+
+#endif // BOOST_DLL_BINARY_READER_HPP
@@ -0,0 +1,122 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_BOUND_SYMBOL_HPP
+#define BOOST_DLL_BOUND_SYMBOL_HPP
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/shared_library.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+/// \file boost/dll/bound_symbol.hpp
+/// \brief Contains the boost::dll::bound_symbol class, a resolved symbol that keeps its library loaded.
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Symbol that is resolved once on construction.
+*
+* Stores the address of the symbol along with a copy of the shared_library, so the library is not unloaded
+* while the bound_symbol exists. Accessing the symbol is a plain pointer dereference without any lookups or checks.
+*
+* \b Example:
+* \code
+* boost::dll::bound_symbol<int(int)> increment(lib, "increment");
+* int i = increment(1);
+*
+* boost::dll::bound_symbol<int> counter(lib, "counter");
+* ++*counter;
+* \endcode
+*
+* \tparam T Type of the symbol: function type or object type.
+*/
+template <class T>
+class bound_symbol {
+    static_assert(!std::is_reference<T>::value, "boost::dll::bound_symbol<T>: T must not be a reference");
+
+    boost::dll::shared_library  lib_;
+    T*                          ptr_;
+
+public:
+    /*!
+    * Creates an instance that references no symbol.
+    * \throws Nothing.
+    */
+    bound_symbol() noexcept
+        : ptr_(nullptr)
+    {}
+
+    /*!
+    * Resolves the symbol with the given name.
+    * \param lib Loaded library, its copy is stored in the bound_symbol.
+    * \param symbol_name Null-terminated symbol name.
+    * \throws \forcedlinkfs{system_error} if symbol does not exist or if the DLL/DSO was not loaded.
+    */
+    bound_symbol(const boost::dll::shared_library& lib, const char* symbol_name)
+        : lib_(lib)
+        , ptr_(std::addressof(lib_.get<T>(symbol_name)))
+    {}
+
+    //! \overload bound_symbol(const boost::dll::shared_library& lib, const char* symbol_name)
+    bound_symbol(const boost::dll::shared_library& lib, const std::string& symbol_name)
+        : bound_symbol(lib, symbol_name.c_str())
+    {}
+
+    /*!
+    * \return Reference to the symbol.
+    * \pre *this is not empty.
+    * \throws Nothing.
+    */
+    T& operator*() const noexcept {
+        return *ptr_;
+    }
+
+    /*!
+    * \return Pointer to the symbol or nullptr if *this is empty.
+    * \throws Nothing.
+    */
+    T* get() const noexcept {
+        return ptr_;
+    }
+
+    /*!
+    * Calls the symbol with the provided arguments.
+    * \pre *this is not empty.
+    * \throws Exceptions thrown by the symbol.
+    */
+    template <class... Args>
+    auto operator()(Args&&... args) const -> decltype((*ptr_)(std::forward<Args>(args)...)) {
+        return (*ptr_)(std::forward<Args>(args)...);
+    }
+
+    /*!
+    * \return true if the symbol is bound.
+    * \throws Nothing.
+    */
+    explicit operator bool() const noexcept {
+        return !!ptr_;
+    }
+
+    /*!
+    * \return Library that contains the symbol.
+    * \throws Nothing.
+    */
+    const boost::dll::shared_library& library() const noexcept {
+        return lib_;
+    }
+};
+
+}} // namespace boost::dll
+
+#endif // BOOST_DLL_BOUND_SYMBOL_HPP
@@ -0,0 +1,178 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_BINARY_SOURCE_HPP
+#define BOOST_DLL_DETAIL_BINARY_SOURCE_HPP
+
+#include <boost/dll/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/core/detail/string_view.hpp>
+#include <boost/dll/binary_reader.hpp>
+#include <boost/throw_exception.hpp>
+
+namespace boost { namespace dll { namespace detail {
+
+// Random access to the bytes of a binary file for the elf_info, pe_info and macho_info parsers.
+//
+// Reads either from a boost::dll::binary_reader or from a contiguous memory block (for example, a memory mapped file).
+// In the latter case data is never copied: `data()` and `c_str()` return pointers right into the memory block.
+//
+// Also holds the parser specific data (headers, section tables, string tables) that is
+// parsed once and reused by all the subsequent queries.
+class binary_source {
+public:
+    struct cache_base {
+        virtual ~cache_base() = default;
+    };
+
+private:
+    boost::dll::binary_reader*  reader_;
+    const char*                 data_;
+    std::uint64_t               size_;
+
+    std::unique_ptr<cache_base> cache_;
+    const void*                 cache_type_;
+
+    template <class T>
+    static const void* type_tag() noexcept {
+        static const char tag = 0;
+        return &tag;
+    }
+
+    [[noreturn]] static void throw_out_of_range() {
+        boost::throw_exception(std::runtime_error("Attempt to read outside of the binary while getting info from it"));
+    }
+
+    void check_range(std::uint64_t offset, std::uint64_t size) const {
+        if (offset > size_ || size > size_ - offset) {
+            throw_out_of_range();
+        }
+    }
+
+public:
+    binary_source() noexcept
+        : reader_(nullptr)
+        , data_(nullptr)
+        , size_(0)
+        , cache_type_(nullptr)
+    {}
+
+    explicit binary_source(boost::dll::binary_reader& reader)
+        : reader_(&reader)
+        , data_(nullptr)
+        , size_(reader.size())
+        , cache_type_(nullptr)
+    {}
+
+    binary_source(const char* data, std::size_t size) noexcept
+        : reader_(nullptr)
+        , data_(data)
+        , size_(size)
+        , cache_type_(nullptr)
+    {}
+
+    binary_source(binary_source&&) = default;
+    binary_source& operator=(binary_source&&) = default;
+
+    // Returns the cached data, calling `init(Cache&)` to fill it on first use.
+    template <class Cache, class Init>
+    const Cache& cached(Init init) {
+        if (!cache_ || cache_type_ != type_tag<Cache>()) {
+            std::unique_ptr<Cache> c(new Cache());
+            init(*c);
+            cache_ = std::move(c);
+            cache_type_ = type_tag<Cache>();
+        }
+
+        return static_cast<const Cache&>(*cache_);
+    }
+
+    // Returns true if the bytes are available without copying.
+    bool in_memory() const noexcept {
+        return !reader_;
+    }
+
+    // Reads `size` bytes at `offset` into `value`.
+    template <class T>
+    void read(std::uint64_t offset, T& value, std::size_t size = sizeof(T)) {
+        check_range(offset, size);
+        if (in_memory()) {
+            std::memcpy(&value, data_ + offset, size);
+        } else {
+            reader_->read(offset, reinterpret_cast<char*>(&value), size);
+        }
+    }
+
+    // Returns a view to `size` bytes at `offset`. `buffer` is used as a storage only if
+    // the bytes are not in memory, so the result is valid as long as the `buffer` is not modified.
+    boost::core::string_view data(std::uint64_t offset, std::uint64_t size, std::vector<char>& buffer) {
+        check_range(offset, size);
+        if (in_memory()) {
+            return boost::core::string_view(data_ + offset, static_cast<std::size_t>(size));
+        }
+
+        if (size > static_cast<std::uint64_t>(buffer.max_size())) {
+            throw_out_of_range();
+        }
+
+        buffer.resize(static_cast<std::size_t>(size));
+        if (size) {
+            reader_->read(offset, buffer.data(), buffer.size());
+        }
+        return boost::core::string_view(buffer.data(), buffer.size());
+    }
+
+    // Returns a null terminated string at `offset`. `buffer` is used as a storage only if
+    // the bytes are not in memory, so the result is valid as long as the `buffer` is not modified.
+    boost::core::string_view c_str(std::uint64_t offset, std::string& buffer) {
+        check_range(offset, 0);
+        if (in_memory()) {
+            const char* const begin = data_ + offset;
+            const void* const end = std::memchr(begin, '\0', static_cast<std::size_t>(size_ - offset));
+            if (!end) {
+                throw_out_of_range();
+            }
+            return boost::core::string_view(begin, static_cast<const char*>(end) - begin);
+        }
+
+        // Reading by chunks, most of the symbol names fit into a single chunk
+        buffer.clear();
+        char chunk[128];
+        while (offset < size_) {
+            const std::size_t chunk_size = static_cast<std::size_t>(
+                (std::min)(static_cast<std::uint64_t>(sizeof(chunk)), size_ - offset)
+            );
+            reader_->read(offset, chunk, chunk_size);
+
+            const void* const end = std::memchr(chunk, '\0', chunk_size);
+            if (end) {
+                buffer.append(chunk, static_cast<const char*>(end) - chunk);
+                return boost::core::string_view(buffer.data(), buffer.size());
+            }
+
+            buffer.append(chunk, chunk_size);
+            offset += chunk_size;
+        }
+
+        throw_out_of_range();
+    }
+};
+
+}}} // namespace boost::dll::detail
+
+#endif // BOOST_DLL_DETAIL_BINARY_SOURCE_HPP
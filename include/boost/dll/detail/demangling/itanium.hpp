@@ -8,6 +8,7 @@
 #define BOOST_DLL_DETAIL_DEMANGLING_ITANIUM_HPP_
 
 #include <boost/dll/detail/demangling/mangled_storage_base.hpp>
+#include <boost/dll/detail/demangling/itanium_mangler.hpp>
 
 #include <algorithm>
 #include <iterator>
@@ -288,10 +289,14 @@ namespace parser
 
 template<typename T> std::string mangled_storage_impl::get_variable(const std::string &name) const
 {
-    auto found = std::find_if(storage_.begin(), storage_.end(),
-            [&](const entry& e) {return e.demangled == name;});
+    // Symbols are compared by the expected mangled name first, that does not require demangling
+    auto found = find_mangled(identifier_of(name), itanium_mangler(*this).variable<T>(name));
+    if (found)
+        return found->mangled;
+
+    found = find_demangled(identifier_of(name), name);
 
-    if (found != storage_.end())
+    if (found)
         return found->mangled;
     else
         return "";
@@ -301,10 +306,14 @@ template<typename Func> std::string mangled_storage_impl::get_function(const std
 {
     using func_type = Func*;
 
+    auto found = find_mangled(identifier_of(name), itanium_mangler(*this).function<Func>(name));
+    if (found)
+        return found->mangled;
+
     auto matcher = name + '(' + parser::arg_list(*this, func_type()) + ')';
 
-    auto found = std::find_if(storage_.begin(), storage_.end(), [&](const entry& e) {return e.demangled == matcher;});
-    if (found != storage_.end())
+    found = find_demangled(identifier_of(name), matcher);
+    if (found)
         return found->mangled;
     else
         return "";
@@ -318,6 +327,9 @@ std::string mangled_storage_impl::get_mem_fn(const std::string &name) const
 
     using func_type = Func*;
 
+    if (auto mangled = find_mangled(identifier_of(name), itanium_mangler(*this).mem_fn<Class, Func>(name)))
+        return mangled->mangled;
+
     std::string cname = get_name<Class>();
 
     const auto matcher = cname + "::" + name +
@@ -325,7 +337,7 @@ std::string mangled_storage_impl::get_mem_fn(const std::string &name) const
              + const_rule<Class>() + volatile_rule<Class>();
 
     // Linux export table contains int MyClass::Func<float>(), but expected in import_mangled MyClass::Func<float>() without returned type.
-    auto found = std::find_if(storage_.begin(), storage_.end(), [&matcher](const entry& e) {
+    auto found = find_member(identifier_of(name), matcher, [&matcher](const entry& e) {
         if (e.demangled == matcher) {
           return true;
         }
@@ -345,7 +357,7 @@ std::string mangled_storage_impl::get_mem_fn(const std::string &name) const
         return e.demangled[pos - 1] == ' '; // `if (e.demangled == matcher)` makes sure that `pos > 0`
     });
 
-    if (found != storage_.end())
+    if (found)
         return found->mangled;
     else
         return "";
@@ -377,17 +389,25 @@ auto mangled_storage_impl::get_constructor() const -> ctor_sym
         }
     }
 
+    ctor_sym ct;
+    {
+        itanium_mangler mangler(*this);
+        const auto id = identifier_of(unscoped_cname);
+        if (auto e = find_mangled(id, mangler.constructor<Signature>("C1")))
+            ct.C1 = e->mangled;
+        if (auto e = find_mangled(id, mangler.constructor<Signature>("C2")))
+            ct.C2 = e->mangled;
+        if (auto e = find_mangled(id, mangler.constructor<Signature>("C3")))
+            ct.C3 = e->mangled;
+        if (!ct.empty())
+            return ct;
+    }
+
     auto matcher =
                 ctor_name + '(' + parser::arg_list(*this, func_type()) + ')';
 
 
-    std::vector<entry> findings;
-    std::copy_if(storage_.begin(), storage_.end(),
-            std::back_inserter(findings), [&](const entry& e) {return e.demangled == matcher;});
-
-    ctor_sym ct;
-
-    for (auto & e : findings)
+    for_each_demangled(identifier_of(unscoped_cname), matcher, [&](const entry& e)
     {
 
         if (e.mangled.find(unscoped_cname +"C1E") != std::string::npos)
@@ -396,7 +416,8 @@ auto mangled_storage_impl::get_constructor() const -> ctor_sym
             ct.C2 = e.mangled;
         else if (e.mangled.find(unscoped_cname +"C3E") != std::string::npos)
             ct.C3 = e.mangled;
-    }
+        return true;
+    });
     return ct;
 }
 
@@ -425,21 +446,30 @@ auto mangled_storage_impl::get_destructor() const -> dtor_sym
     auto d2 = unscoped_cname + "D2Ev";
 
     dtor_sym dt;
-    //this is so simple, i don#t need a predicate
-    for (auto & s : storage_)
     {
-        //alright, name fits
-        if (s.demangled == dtor_name)
-        {
-            if (s.mangled.find(d0) != std::string::npos)
-                dt.D0 = s.mangled;
-            else if (s.mangled.find(d1) != std::string::npos)
-                dt.D1 = s.mangled;
-            else if (s.mangled.find(d2) != std::string::npos)
-                dt.D2 = s.mangled;
-
-        }
+        itanium_mangler mangler(*this);
+        const auto id = identifier_of(unscoped_cname);
+        if (auto e = find_mangled(id, mangler.destructor<Class>("D0")))
+            dt.D0 = e->mangled;
+        if (auto e = find_mangled(id, mangler.destructor<Class>("D1")))
+            dt.D1 = e->mangled;
+        if (auto e = find_mangled(id, mangler.destructor<Class>("D2")))
+            dt.D2 = e->mangled;
+        if (!dt.empty())
+            return dt;
     }
+
+    //this is so simple, i don#t need a predicate
+    for_each_demangled(identifier_of(unscoped_cname), dtor_name, [&](const entry& s)
+    {
+        if (s.mangled.find(d0) != std::string::npos)
+            dt.D0 = s.mangled;
+        else if (s.mangled.find(d1) != std::string::npos)
+            dt.D1 = s.mangled;
+        else if (s.mangled.find(d2) != std::string::npos)
+            dt.D2 = s.mangled;
+        return true;
+    });
     return dt;
 
 }
@@ -447,18 +477,16 @@ auto mangled_storage_impl::get_destructor() const -> dtor_sym
 template<typename T>
 std::string mangled_storage_impl::get_type_info() const
 {
-    std::string id = "typeinfo for " + get_name<T>();
+    const std::string cname = get_name<T>();
+    std::string id = "typeinfo for " + cname;
 
+    auto found = find_mangled(identifier_of(cname), itanium_mangler(*this).type_info<T>());
+    if (found)
+        return found->mangled;
 
-    auto predicate = [&](const mangled_storage_base::entry & e)
-                {
-                    return e.demangled == id;
-                };
-
-    auto found = std::find_if(storage_.begin(), storage_.end(), predicate);
-
+    found = find_demangled(identifier_of(cname), id);
 
-    if (found != storage_.end())
+    if (found)
         return found->mangled;
     else
         return "";
@@ -470,6 +498,7 @@ std::vector<std::string> mangled_storage_impl::get_related()  const
     std::vector<std::string> ret;
     auto name = get_name<T>();
 
+    demangle_all();
     for (auto & c : storage_)
     {
         if (c.demangled.find(name) != std::string::npos)
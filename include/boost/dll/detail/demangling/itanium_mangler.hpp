@@ -0,0 +1,380 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_DEMANGLING_ITANIUM_MANGLER_HPP_
+#define BOOST_DLL_DETAIL_DEMANGLING_ITANIUM_MANGLER_HPP_
+
+#include <boost/dll/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <boost/dll/detail/demangling/mangled_storage_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+
+namespace boost { namespace dll { namespace detail {
+
+namespace mangler {
+
+template<typename T> struct builtin               { static const char* code() noexcept { return nullptr; } };
+template<> struct builtin<void>                   { static const char* code() noexcept { return "v"; } };
+template<> struct builtin<bool>                   { static const char* code() noexcept { return "b"; } };
+template<> struct builtin<char>                   { static const char* code() noexcept { return "c"; } };
+template<> struct builtin<signed char>            { static const char* code() noexcept { return "a"; } };
+template<> struct builtin<unsigned char>          { static const char* code() noexcept { return "h"; } };
+template<> struct builtin<wchar_t>                { static const char* code() noexcept { return "w"; } };
+template<> struct builtin<char16_t>               { static const char* code() noexcept { return "Ds"; } };
+template<> struct builtin<char32_t>               { static const char* code() noexcept { return "Di"; } };
+template<> struct builtin<short>                  { static const char* code() noexcept { return "s"; } };
+template<> struct builtin<unsigned short>         { static const char* code() noexcept { return "t"; } };
+template<> struct builtin<int>                    { static const char* code() noexcept { return "i"; } };
+template<> struct builtin<unsigned int>           { static const char* code() noexcept { return "j"; } };
+template<> struct builtin<long>                   { static const char* code() noexcept { return "l"; } };
+template<> struct builtin<unsigned long>          { static const char* code() noexcept { return "m"; } };
+template<> struct builtin<long long>              { static const char* code() noexcept { return "x"; } };
+template<> struct builtin<unsigned long long>     { static const char* code() noexcept { return "y"; } };
+template<> struct builtin<float>                  { static const char* code() noexcept { return "f"; } };
+template<> struct builtin<double>                 { static const char* code() noexcept { return "d"; } };
+template<> struct builtin<long double>            { static const char* code() noexcept { return "e"; } };
+template<> struct builtin<decltype(nullptr)>      { static const char* code() noexcept { return "Dn"; } };
+
+template<typename Func> struct signature;
+template<typename Return, typename ...Args>
+struct signature<Return(Args...)>
+{
+    using return_type = Return;
+};
+
+}  // namespace mangler
+
+/*!
+ * Produces the Itanium ABI mangled names of the entities from their names and C++ types, so that the symbols could be
+ * found without demangling the symbol table.
+ *
+ * Only the names that consist of identifiers and the types that are built in, classes or enums (possibly cv qualified),
+ * pointers and references to them are supported. Templates, operators, entities from the `std` namespace and the
+ * anonymous namespaces are not. An empty string is returned for the unsupported names.
+ */
+class itanium_mangler
+{
+    const mangled_storage_base & ms_;
+    std::string out_;
+    std::vector<std::string> substitutions_;
+    bool ok_ = true;
+
+    static std::string source_name(boost::core::string_view id)
+    {
+        return std::to_string(id.size()) + std::string(id.data(), id.size());
+    }
+
+    std::vector<boost::core::string_view> split(boost::core::string_view name)
+    {
+        std::vector<boost::core::string_view> parts;
+        if (!ok_)
+            return parts;
+
+        for (std::size_t pos = 0; ok_;)
+        {
+            const auto next = name.find("::", pos);
+            parts.push_back(name.substr(pos, next == boost::core::string_view::npos ? next : next - pos));
+            ok_ = is_identifier(parts.back()) && parts.back().substr(0, 8) != "operator";
+            if (next == boost::core::string_view::npos)
+                break;
+            pos = next + 2;
+        }
+
+        // Entities of the `std` namespace have special encodings and abbreviations
+        ok_ = ok_ && parts.front() != "std";
+        return parts;
+    }
+
+    bool try_substitute(const std::string& key)
+    {
+        static const char digits[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+        for (std::size_t i = 0; i < substitutions_.size(); ++i)
+        {
+            if (substitutions_[i] != key)
+                continue;
+
+            // S_, S0_, ..., SZ_, S10_, ...
+            std::string seq_id;
+            if (i)
+            {
+                std::size_t n = i - 1;
+                do
+                {
+                    seq_id.insert(seq_id.begin(), digits[n % 36]);
+                    n /= 36;
+                } while (n);
+            }
+            out_ += 'S';
+            out_ += seq_id;
+            out_ += '_';
+            return true;
+        }
+        return false;
+    }
+
+    // Emits the prefix made of the first `count` parts, each of the nested prefixes becomes a substitution candidate
+    void prefix(const std::vector<boost::core::string_view>& parts, std::size_t count)
+    {
+        std::vector<std::string> keys(count);
+        for (std::size_t i = 0; i < count; ++i)
+            keys[i] = (i ? keys[i - 1] : std::string()) + source_name(parts[i]);
+
+        std::size_t begin = count;
+        while (begin > 0 && !try_substitute(keys[begin - 1]))
+            --begin;
+
+        for (std::size_t i = begin; i < count; ++i)
+        {
+            out_ += source_name(parts[i]);
+            substitutions_.push_back(keys[i]);
+        }
+    }
+
+    void class_type(const std::string& name)
+    {
+        const auto parts = split(name);
+        if (!ok_)
+            return;
+
+        std::string key;
+        for (auto & p : parts)
+            key += source_name(p);
+        if (try_substitute(key))
+            return;
+
+        if (parts.size() == 1)
+        {
+            prefix(parts, 1);
+            return;
+        }
+
+        out_ += 'N';
+        prefix(parts, parts.size());
+        out_ += 'E';
+    }
+
+    // Encoding of the type without substitutions, that identifies the substitution candidate
+    template<typename T>
+    std::string key()
+    {
+        using U = typename std::remove_cv<T>::type;
+        if (std::is_volatile<T>::value || std::is_const<T>::value)
+            return cv<T>() + key<U>();
+        if (std::is_pointer<U>::value)
+            return "P" + key<typename std::remove_pointer<U>::type>();
+        if (std::is_lvalue_reference<U>::value)
+            return "R" + key<typename std::remove_reference<U>::type>();
+        if (std::is_rvalue_reference<U>::value)
+            return "O" + key<typename std::remove_reference<U>::type>();
+        if (mangler::builtin<U>::code())
+            return mangler::builtin<U>::code();
+
+        const std::string class_name = ms_.get_name<U>();
+        std::string k;
+        for (auto & p : split(class_name))
+            k += source_name(p);
+        return k;
+    }
+
+    template<typename T>
+    static std::string cv()
+    {
+        return std::string(std::is_volatile<T>::value ? "V" : "") + (std::is_const<T>::value ? "K" : "");
+    }
+
+    template<typename T>
+    void compound_type(const char* code)
+    {
+        const auto k = key<T>();
+        if (try_substitute(k))
+            return;
+
+        out_ += code;
+        type<typename std::remove_reference<typename std::remove_pointer<typename std::remove_cv<T>::type>::type>::type>();
+        substitutions_.push_back(k);
+    }
+
+    template<typename T>
+    void type()
+    {
+        using U = typename std::remove_cv<T>::type;
+        if (std::is_volatile<T>::value || std::is_const<T>::value)
+        {
+            const auto k = key<T>();
+            if (try_substitute(k))
+                return;
+
+            out_ += cv<T>();
+            type<U>();
+            substitutions_.push_back(k);
+        }
+        else if (std::is_pointer<U>::value)
+            compound_type<U>("P");
+        else if (std::is_lvalue_reference<U>::value)
+            compound_type<U>("R");
+        else if (std::is_rvalue_reference<U>::value)
+            compound_type<U>("O");
+        else if (mangler::builtin<U>::code())
+            out_ += mangler::builtin<U>::code();
+        else if (std::is_class<U>::value || std::is_enum<U>::value || std::is_union<U>::value)
+            class_type(ms_.get_name<U>());
+        else
+            ok_ = false;
+    }
+
+    template<typename Return, typename ...Args>
+    void parameters(Return(*)(Args...))
+    {
+        if (!sizeof...(Args))
+            out_ += 'v';
+
+        const int expand[] = {0, (type<Args>(), 0)...};
+        (void)expand;
+    }
+
+    void parameters(...)
+    {
+        // Function types with noexcept or C style variadic arguments
+        ok_ = false;
+    }
+
+    template<typename Func>
+    void function_parameters()
+    {
+        parameters(static_cast<typename std::add_pointer<Func>::type>(nullptr));
+    }
+
+    void reset()
+    {
+        out_.clear();
+        substitutions_.clear();
+        ok_ = true;
+    }
+
+    std::string result()
+    {
+        return ok_ ? out_ : std::string();
+    }
+
+    // Emits `N <prefix> <name> E` or the unscoped name
+    void name(const std::string& full_name)
+    {
+        const auto parts = split(full_name);
+        if (!ok_)
+            return;
+
+        if (parts.size() == 1)
+        {
+            out_ += source_name(parts.front());
+            return;
+        }
+
+        out_ += 'N';
+        prefix(parts, parts.size() - 1);
+        out_ += source_name(parts.back());
+        out_ += 'E';
+    }
+
+    template<typename Class>
+    void class_member(const char* cv_qualifiers, const std::string& member)
+    {
+        const std::string class_name = ms_.get_name<typename std::remove_cv<Class>::type>();
+        const auto parts = split(class_name);
+        if (!ok_)
+            return;
+
+        out_ += "_ZN";
+        out_ += cv_qualifiers;
+        prefix(parts, parts.size());
+        out_ += member;
+        out_ += 'E';
+    }
+
+public:
+    explicit itanium_mangler(const mangled_storage_base & ms) : ms_(ms) {}
+
+    ///Returns the mangled name of the namespace scope or static member variable. Variables of the global namespace are not mangled.
+    template<typename T>
+    std::string variable(const std::string& full_name)
+    {
+        reset();
+        if (full_name.find("::") == std::string::npos)
+            return is_identifier(full_name) ? full_name : std::string();
+
+        out_ += "_Z";
+        name(full_name);
+        return result();
+    }
+
+    ///Returns the mangled name of the function or the static member function that is not a template.
+    template<typename Func>
+    std::string function(const std::string& full_name)
+    {
+        reset();
+        out_ += "_Z";
+        name(full_name);
+        if (ok_)
+            function_parameters<Func>();
+        return result();
+    }
+
+    ///Returns the mangled name of the non static member function that is not a template. `Class` is cv qualified for the cv qualified functions.
+    template<typename Class, typename Func>
+    std::string mem_fn(const std::string& member)
+    {
+        reset();
+        ok_ = is_identifier(member) && member.substr(0, 8) != "operator";
+        if (ok_)
+            class_member<Class>(cv<Class>().c_str(), source_name(member).c_str());
+        if (ok_)
+            function_parameters<Func>();
+        return result();
+    }
+
+    ///Returns the mangled name of the `kind` ("C1", "C2" or "C3") constructor of the class, which is the return type of the `Signature`.
+    template<typename Signature>
+    std::string constructor(const char* kind)
+    {
+        reset();
+        class_member<typename mangler::signature<Signature>::return_type>("", kind);
+        if (ok_)
+            function_parameters<Signature>();
+        return result();
+    }
+
+    ///Returns the mangled name of the `kind` ("D0", "D1" or "D2") destructor of the `Class`.
+    template<typename Class>
+    std::string destructor(const char* kind)
+    {
+        reset();
+        class_member<Class>("", kind);
+        out_ += 'v';
+        return result();
+    }
+
+    ///Returns the mangled name of the type_info object of the `T`.
+    template<typename T>
+    std::string type_info()
+    {
+        reset();
+        out_ += "_ZTI";
+        type<T>();
+        return result();
+    }
+};
+
+}}}
+
+#endif /* BOOST_DLL_DETAIL_DEMANGLING_ITANIUM_MANGLER_HPP_ */
@@ -7,53 +7,518 @@
 #ifndef BOOST_DLL_DETAIL_MANGLE_STORAGE_BASE_HPP_
 #define BOOST_DLL_DETAIL_MANGLE_STORAGE_BASE_HPP_
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
 #include <vector>
 #include <string>
 #include <map>
+#include <mutex>
+#include <system_error>
 #include <type_traits>
+#include <unordered_map>
 
 #include <boost/dll/detail/demangling/demangle_symbol.hpp>
+#include <boost/dll/detail/demangling/string_pool.hpp>
 #include <boost/dll/library_info.hpp>
+#include <boost/dll/loaded_library_info.hpp>
+#include <boost/dll/library_index.hpp>
 #include <boost/type_index/ctti_type_index.hpp>
+#include <boost/core/detail/string_view.hpp>
 
 
 namespace boost { namespace dll { namespace detail {
 
+///Returns true if `id` is a C++ identifier. '$' is accepted, as the compilers allow it as an extension and mangle it as is.
+inline bool is_identifier(boost::core::string_view id)
+{
+    if (id.empty() || (id[0] >= '0' && id[0] <= '9'))
+        return false;
+    for (char c : id)
+        if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '$'))
+            return false;
+    return true;
+}
+
 ///stores the mangled names with the demangled name.
 struct mangled_storage_base
 {
+    ///Names are owned by the mangled_storage_base and are valid until it is cleared, reloaded or destroyed
     struct entry
     {
-        std::string mangled;
-        std::string demangled;
+        pooled_string mangled;
+        pooled_string demangled;
         entry() = default;
-        entry(const std::string & m, const std::string &d) : mangled(m), demangled(d) {}
+        entry(pooled_string m, pooled_string d) noexcept : mangled(m), demangled(d) {}
         entry(const entry&) = default;
         entry(entry&&)         = default;
         entry &operator= (const entry&) = default;
         entry &operator= (entry&&)         = default;
     };
+private:
+    struct name_hash
+    {
+        std::size_t operator()(boost::core::string_view name) const noexcept
+        {
+            std::size_t h = 2166136261u;
+            for (char c : name)
+                h = (h ^ static_cast<unsigned char>(c)) * 16777619u;
+            return h;
+        }
+    };
+    static constexpr std::size_t no_entry = static_cast<std::size_t>(-1);
+
+    ///Chains of the entries with the same key, in the order of `storage_`
+    struct name_index
+    {
+        ///key -> {first entry, last entry}
+        std::unordered_map<boost::core::string_view, std::pair<std::size_t, std::size_t>, name_hash> heads;
+        std::vector<std::size_t> next;
+
+        void clear()
+        {
+            heads.clear();
+            next.clear();
+        }
+        void add(boost::core::string_view key, std::size_t i)
+        {
+            next.push_back(no_entry);
+            auto res = heads.emplace(key, std::make_pair(i, i));
+            if (!res.second)
+            {
+                next[res.first->second.second] = i;
+                res.first->second.second = i;
+            }
+        }
+        std::size_t first(boost::core::string_view key) const
+        {
+            auto it = heads.find(key);
+            return it == heads.end() ? no_entry : it->second.first;
+        }
+    };
+
+    ///Keys of the indexes point into the `strings_`, so the indexes are rebuilt on each modification of the `storage_`.
+    ///Length prefixed identifiers of the Itanium mangled names (or the whole not mangled names) -> entries that contain them
+    std::unordered_map<boost::core::string_view, std::vector<std::size_t>, name_hash> by_identifier_;
+    ///false if `storage_` was exposed via get_storage() and could be modified
+    bool index_valid_ = false;
+
+    ///Guards the lazy demangling and the indexes by the demangled names, that are modified by the const lookups
+    mutable std::mutex mutex_;
+    mutable name_index by_demangled_;
+    mutable name_index by_member_;
+    mutable bool demangled_index_valid_ = false;
+    mutable bool all_demangled_ = false;
+    ///Number of threads for demangling all the entries, 0 means std::thread::hardware_concurrency()
+    std::size_t demangle_threads_ = 1;
+    ///Names of the `storage_` entries, consecutive entries are stored next to each other
+    mutable string_pool strings_;
+
+    ///Calls `f(id)` for each `<length><identifier>` part of the Itanium mangled name or for the whole name if it is not mangled.
+    ///May report some parts that are not the source names, but never misses one.
+    template<typename F>
+    static void for_each_identifier(boost::core::string_view mangled, F f)
+    {
+        if (mangled.substr(0, 2) != "_Z" && mangled.substr(0, 3) != "__Z")
+        {
+            f(mangled);
+            return;
+        }
+
+        // Length may directly follow the digits of the previous identifier, e.g. `7__cxx1112basic_string`
+        for (std::size_t i = 0; i < mangled.size(); ++i)
+        {
+            if (mangled[i] < '1' || mangled[i] > '9')
+                continue;
+
+            std::size_t j = i;
+            std::size_t len = 0;
+            while (j < mangled.size() && mangled[j] >= '0' && mangled[j] <= '9' && len <= mangled.size())
+                len = len * 10 + static_cast<std::size_t>(mangled[j++] - '0');
+
+            if (len <= mangled.size() - j && is_identifier(mangled.substr(j, len)))
+                f(mangled.substr(j, len));
+        }
+    }
+
+    static void demangle(entry & e, string_pool & strings)
+    {
+        if (!e.demangled.empty())
+            return;
+
+        const auto dm = demangle_symbol(e.mangled.c_str());
+        if (dm.empty() || dm == e.mangled)
+            e.demangled = e.mangled;
+        else
+            e.demangled = strings.add(dm);
+    }
+
+    void copy_entries_locked(const mangled_storage_base & other)
+    {
+        clear_entries();
+        storage_.reserve(other.storage_.size());
+        for (auto & e : other.storage_)
+        {
+            const auto m = strings_.add(e.mangled);
+            if (e.demangled.data() == e.mangled.data())
+                storage_.emplace_back(m, m);
+            else
+                storage_.emplace_back(m, e.demangled.empty() ? pooled_string() : strings_.add(e.demangled));
+        }
+        reindex();
+    }
+
+    void demangle_all_locked() const
+    {
+        if (all_demangled_)
+            return;
+
+        // Entries are demangled in chunks, so that the threads do not share cache lines
+        constexpr std::size_t chunk = 256;
+        std::size_t threads_count = demangle_threads_ ? demangle_threads_ : std::thread::hardware_concurrency();
+        if (threads_count > storage_.size() / chunk)
+            threads_count = storage_.size() / chunk;
+
+        if (threads_count < 2)
+        {
+            for (auto & e : storage_)
+                demangle(e, strings_);
+            all_demangled_ = true;
+            return;
+        }
+
+        std::atomic<std::size_t> next{0};
+        std::vector<std::exception_ptr> errors(threads_count);
+        std::vector<string_pool> pools(threads_count);
+        const auto worker = [this, &next, &errors, &pools](std::size_t worker_index) noexcept {
+            try
+            {
+                for (std::size_t begin = next.fetch_add(chunk); begin < storage_.size(); begin = next.fetch_add(chunk))
+                {
+                    const std::size_t end = (std::min)(begin + chunk, storage_.size());
+                    for (std::size_t i = begin; i < end; ++i)
+                        demangle(storage_[i], pools[worker_index]);
+                }
+            }
+            catch (...)
+            {
+                errors[worker_index] = std::current_exception();
+                next = storage_.size();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(threads_count - 1);
+        for (std::size_t i = 1; i < threads_count; ++i)
+        {
+            try
+            {
+                threads.emplace_back(worker, i);
+            }
+            catch (const std::system_error&)
+            {
+                // Not enough resources for a thread, the rest of the work is done by the started ones
+                break;
+            }
+        }
+
+        worker(0);
+        for (auto & t : threads)
+            t.join();
+
+        // Names demangled by the workers are moved to the `strings_` without copying
+        for (auto & p : pools)
+            strings_.splice(p);
+        for (auto & e : errors)
+            if (e)
+                std::rethrow_exception(e);
+        all_demangled_ = true;
+    }
+
+    void build_demangled_index_locked() const
+    {
+        if (demangled_index_valid_)
+            return;
+
+        demangle_all_locked();
+        by_demangled_.clear();
+        by_member_.clear();
+        for (std::size_t i = 0; i < storage_.size(); ++i)
+        {
+            by_demangled_.add(storage_[i].demangled, i);
+            by_member_.add(member_key(storage_[i].demangled), i);
+        }
+        demangled_index_valid_ = true;
+    }
+
+    ///Returns the entries that contain the `id` or nullptr if all the entries should be checked.
+    const std::vector<std::size_t>* candidates_locked(boost::core::string_view id) const
+    {
+        static const std::vector<std::size_t> none;
+        if (!index_valid_ || all_demangled_ || id.empty())
+            return nullptr;
+
+        auto it = by_identifier_.find(id);
+        return it == by_identifier_.end() ? &none : &it->second;
+    }
+
 protected:
-    std::vector<entry> storage_;
+    ///Entries with empty `demangled` are not demangled yet
+    mutable std::vector<entry> storage_;
     ///if a unknown class is imported it can be overloaded by this type
     std::map<boost::typeindex::ctti_type_index, std::string> aliases_;
+
+    ///Returns the `name(args) qualifiers` part of the demangled function name, dropping the scope and the return type.
+    static boost::core::string_view member_key(boost::core::string_view demangled)
+    {
+        const auto close = demangled.rfind(')');
+        if (close == boost::core::string_view::npos)
+            return demangled;
+
+        std::size_t open = close;
+        int depth = 0;
+        for (;; --open)
+        {
+            if (demangled[open] == ')')
+                ++depth;
+            else if (demangled[open] == '(' && --depth == 0)
+                break;
+            if (open == 0)
+                return demangled;
+        }
+
+        int angles = 0;
+        depth = 0;
+        for (std::size_t i = open; i > 0; --i)
+        {
+            const char c = demangled[i - 1];
+            if (c == '>') ++angles;
+            else if (c == '<') --angles;
+            else if (c == ')') ++depth;
+            else if (c == '(') --depth;
+            else if (angles <= 0 && depth <= 0 && (c == ' ' || (c == ':' && i > 1 && demangled[i - 2] == ':')))
+                return demangled.substr(i);
+        }
+        return demangled;
+    }
+
+    ///Returns the unqualified name without template arguments, that is stored as is in the Itanium mangled name,
+    ///or an empty string if the name could be mangled differently (operators, std:: abbreviations).
+    static boost::core::string_view identifier_of(boost::core::string_view name)
+    {
+        std::size_t begin = 0;
+        std::size_t end = boost::core::string_view::npos;
+        int depth = 0;
+        for (std::size_t i = 0; i < name.size(); ++i)
+        {
+            const char c = name[i];
+            if (c == '<' || c == '(')
+            {
+                if (depth++ == 0 && end == boost::core::string_view::npos)
+                    end = i;
+            }
+            else if (c == '>' || c == ')')
+                --depth;
+            else if (depth == 0 && c == ':' && i + 1 < name.size() && name[i + 1] == ':')
+            {
+                begin = i + 2;
+                end = boost::core::string_view::npos;
+                ++i;
+            }
+        }
+
+        const auto id = name.substr(begin, end == boost::core::string_view::npos ? end : end - begin);
+        static const char* const abbreviated[] = {
+            "operator", "allocator", "basic_string", "string", "char_traits",
+            "basic_istream", "basic_ostream", "basic_iostream", "istream", "ostream", "iostream"
+        };
+        for (const char* a : abbreviated)
+            if (id == a)
+                return {};
+
+        return is_identifier(id) ? id : boost::core::string_view{};
+    }
+
+    void clear_entries()
+    {
+        storage_.clear();
+        strings_.clear();
+        reindex();
+    }
+
+    void reindex()
+    {
+        by_identifier_.clear();
+        all_demangled_ = true;
+        for (std::size_t i = 0; i < storage_.size(); ++i)
+        {
+            all_demangled_ = all_demangled_ && !storage_[i].demangled.empty();
+            for_each_identifier(storage_[i].mangled, [this, i](boost::core::string_view id) {
+                auto & entries = by_identifier_[id];
+                if (entries.empty() || entries.back() != i)
+                    entries.push_back(i);
+            });
+        }
+        index_valid_ = true;
+        demangled_index_valid_ = false;
+        by_demangled_.clear();
+        by_member_.clear();
+    }
+
+    ///Calls `f(entry)` for each entry with the demangled name `name` while `f` returns true.
+    ///`id` is the identifier_of() the entity, only the entries that contain it are demangled.
+    template<typename F>
+    void for_each_demangled(boost::core::string_view id, boost::core::string_view name, F f) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (auto candidates = candidates_locked(id))
+        {
+            for (auto i : *candidates)
+            {
+                demangle(storage_[i], strings_);
+                if (name == storage_[i].demangled && !f(storage_[i]))
+                    return;
+            }
+            return;
+        }
+
+        if (!index_valid_)
+        {
+            demangle_all_locked();
+            for (auto & e : storage_)
+                if (name == e.demangled && !f(e))
+                    return;
+            return;
+        }
+
+        build_demangled_index_locked();
+        for (auto i = by_demangled_.first(name); i != no_entry; i = by_demangled_.next[i])
+            if (!f(storage_[i]))
+                return;
+    }
+
+    ///Returns the first entry with the demangled name `name` that satisfies `pred` or nullptr.
+    template<typename Pred>
+    const entry* find_demangled(boost::core::string_view id, boost::core::string_view name, Pred pred) const
+    {
+        const entry* found = nullptr;
+        for_each_demangled(id, name, [&](const entry& e) {
+            found = (pred(e) ? &e : nullptr);
+            return !found;
+        });
+        return found;
+    }
+
+    const entry* find_demangled(boost::core::string_view id, boost::core::string_view name) const
+    {
+        return find_demangled(id, name, [](const entry&) { return true; });
+    }
+
+    ///Returns the first entry that satisfies `pred`. Only the entries that contain the `id` are checked if it is not empty.
+    ///Otherwise the entries with the same member_key() as `matcher` are checked, and if none of them satisfies `pred`
+    ///all the entries are checked.
+    template<typename Pred>
+    const entry* find_member(boost::core::string_view id, boost::core::string_view matcher, Pred pred) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (auto candidates = candidates_locked(id))
+        {
+            for (auto i : *candidates)
+            {
+                demangle(storage_[i], strings_);
+                if (pred(storage_[i]))
+                    return &storage_[i];
+            }
+            return nullptr;
+        }
+
+        if (index_valid_)
+        {
+            build_demangled_index_locked();
+            for (auto i = by_member_.first(member_key(matcher)); i != no_entry; i = by_member_.next[i])
+                if (pred(storage_[i]))
+                    return &storage_[i];
+        }
+
+        demangle_all_locked();
+        for (auto & e : storage_)
+            if (pred(e))
+                return &e;
+        return nullptr;
+    }
+    ///Returns the entry with the mangled name `mangled` or nullptr, without demangling anything.
+    ///Only the entries that contain the `id` are checked if it is not empty.
+    const entry* find_mangled(boost::core::string_view id, boost::core::string_view mangled) const
+    {
+        // Mangled names are never modified by the const methods, so no locking is required
+        if (mangled.empty())
+            return nullptr;
+
+        if (index_valid_ && !id.empty())
+        {
+            auto it = by_identifier_.find(id);
+            if (it == by_identifier_.end())
+                return nullptr;
+
+            for (auto i : it->second)
+                if (storage_[i].mangled == mangled)
+                    return &storage_[i];
+            return nullptr;
+        }
+
+        for (auto & e : storage_)
+            if (e.mangled == mangled)
+                return &e;
+        return nullptr;
+    }
 public:
     void assign(const mangled_storage_base & storage)
     {
+        if (&storage == this)
+            return;
+
+        std::lock_guard<std::mutex> lock(storage.mutex_);
         aliases_  = storage.aliases_;
-        storage_  = storage.storage_;
+        copy_entries_locked(storage);
     }
     void swap( mangled_storage_base & storage)
     {
+        // Strings are not moved by the vector swap, so the indexes stay valid
         aliases_.swap(storage.aliases_);
         storage_.swap(storage.storage_);
+        strings_.swap(storage.strings_);
+        by_identifier_.swap(storage.by_identifier_);
+        std::swap(index_valid_, storage.index_valid_);
+        std::swap(by_demangled_, storage.by_demangled_);
+        std::swap(by_member_, storage.by_member_);
+        std::swap(demangled_index_valid_, storage.demangled_index_valid_);
+        std::swap(all_demangled_, storage.all_demangled_);
+        std::swap(demangle_threads_, storage.demangle_threads_);
     }
     void clear()
     {
-        storage_.clear();
+        clear_entries();
         aliases_.clear();
     }
-    std::vector<entry> & get_storage() {return storage_;};
+    /*! Sets the number of threads that are used when all the entries have to be demangled: by demangle_all(),
+     * get_storage(), get_related() and the lookups of the names that could not be prefiltered.
+     *  @param threads_count Number of threads including the calling one, 0 means std::thread::hardware_concurrency().
+     *  Libraries with less than 512 symbols are always demangled in the calling thread.
+     */
+    void set_demangle_threads(std::size_t threads_count) noexcept
+    {
+        demangle_threads_ = threads_count;
+    }
+    ///Demangles all the entries. Entries are not modified by the lookups after this call.
+    void demangle_all() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        demangle_all_locked();
+    }
+    ///Demangles all the entries. Lookups do not use the indexes after this call, until the storage is reloaded or reindex() is called.
+    std::vector<entry> & get_storage() {demangle_all(); index_valid_ = false; return storage_;};
     template<typename T>
     std::string get_name() const
     {
@@ -64,8 +529,29 @@ public:
     }
 
     mangled_storage_base() = default;
-    mangled_storage_base(mangled_storage_base&&) = default;
-    mangled_storage_base(const mangled_storage_base&) = default;
+    mangled_storage_base(mangled_storage_base&& other)
+        : by_identifier_(std::move(other.by_identifier_))
+        , index_valid_(other.index_valid_)
+        , by_demangled_(std::move(other.by_demangled_))
+        , by_member_(std::move(other.by_member_))
+        , demangled_index_valid_(other.demangled_index_valid_)
+        , all_demangled_(other.all_demangled_)
+        , demangle_threads_(other.demangle_threads_)
+        , strings_(std::move(other.strings_))
+        , storage_(std::move(other.storage_))
+        , aliases_(std::move(other.aliases_))
+    {
+        // Neither the elements of the `storage_` nor the strings are moved, so the indexes stay valid
+        other.index_valid_ = false;
+        other.demangled_index_valid_ = false;
+    }
+    mangled_storage_base(const mangled_storage_base& other)
+    {
+        std::lock_guard<std::mutex> lock(other.mutex_);
+        aliases_ = other.aliases_;
+        demangle_threads_ = other.demangle_threads_;
+        copy_entries_locked(other);
+    }
 
     mangled_storage_base(const std::vector<std::string> & symbols) { add_symbols(symbols);}
 
@@ -79,13 +565,30 @@ public:
 
     }
 
-    void load(library_info & li) { storage_.clear(); add_symbols(li.symbols()); };
+    void load(library_info & li) { clear_entries(); add_symbols(li.symbols()); };
     void load(const boost::dll::fs::path& library_path,
             bool throw_if_not_native_format = true)
     {
-        storage_.clear();
+        clear_entries();
         add_symbols(library_info(library_path, throw_if_not_native_format).symbols());
     };
+    ///Reads the symbols of the already loaded library from memory if possible
+    void load(const shared_library& lib)
+    {
+        clear_entries();
+        add_symbols(loaded_library_info(lib).symbols());
+    };
+    ///Takes the symbols and their demangled names from the index, skipping the binary parsing if the index is up to date
+    void load(library_index& index, const boost::dll::fs::path& library_path)
+    {
+        clear_entries();
+        for (auto & sym : index.demangled_symbols(library_path))
+        {
+            const auto m = strings_.add(sym.first);
+            storage_.emplace_back(m, sym.first == sym.second ? m : strings_.add(sym.second));
+        }
+        reindex();
+    };
 
     /*! Allows do add a class as alias, if the class imported is not known
      * in this binary.
@@ -103,14 +606,11 @@ public:
     }
     void add_symbols(const std::vector<std::string> & symbols)
     {
+        // Symbols are demangled on the first lookup that matches them
+        storage_.reserve(storage_.size() + symbols.size());
         for (auto & sym : symbols)
-        {
-            auto dm = demangle_symbol(sym);
-            if (!dm.empty())
-                storage_.emplace_back(sym, dm);
-            else
-                storage_.emplace_back(sym, sym);
-        }
+            storage_.emplace_back(strings_.add(sym), pooled_string());
+        reindex();
     }
 
 
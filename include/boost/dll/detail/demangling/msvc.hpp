@@ -333,6 +333,7 @@ namespace parser {
 
 template<typename T>
 std::string mangled_storage_impl::get_variable(const std::string &name) const {
+    demangle_all();
     const auto found = std::find_if(storage_.begin(), storage_.end(), parser::is_variable_with_name<T>(name, *this));
 
     if (found != storage_.end())
@@ -343,6 +344,7 @@ std::string mangled_storage_impl::get_variable(const std::string &name) const {
 
 template<typename Func>
 std::string mangled_storage_impl::get_function(const std::string &name) const {
+    demangle_all();
     const auto found = std::find_if(storage_.begin(), storage_.end(), parser::is_function_with_name<Func*>(name, *this));
 
     if (found != storage_.end())
@@ -353,6 +355,7 @@ std::string mangled_storage_impl::get_function(const std::string &name) const {
 
 template<typename Class, typename Func>
 std::string mangled_storage_impl::get_mem_fn(const std::string &name) const {
+    demangle_all();
     const auto found = std::find_if(storage_.begin(), storage_.end(), parser::is_mem_fn_with_name<Class, Func*>(name, *this));
 
     if (found != storage_.end())
@@ -381,6 +384,7 @@ auto mangled_storage_impl::get_constructor() const -> ctor_sym {
         }
     }
 
+    demangle_all();
     const auto f = std::find_if(storage_.begin(), storage_.end(), parser::is_constructor_with_name<Signature*>(ctor_name, *this));
 
     if (f != storage_.end())
@@ -408,6 +412,7 @@ auto mangled_storage_impl::get_destructor() const -> dtor_sym {
         }
     }
 
+    demangle_all();
     const auto found = std::find_if(storage_.begin(), storage_.end(), parser::is_destructor_with_name(dtor_name));
 
     if (found != storage_.end())
@@ -425,6 +430,7 @@ std::string mangled_storage_impl::get_vtable() const {
                     return e.demangled == id;
                 };
 
+    demangle_all();
     auto found = std::find_if(storage_.begin(), storage_.end(), predicate);
 
 
@@ -439,6 +445,7 @@ std::vector<std::string> mangled_storage_impl::get_related() const {
     std::vector<std::string> ret;
     auto name = get_name<T>();
 
+    demangle_all();
     for (auto & c : storage_)
     {
         if (c.demangled.find(name) != std::string::npos)
@@ -0,0 +1,154 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_DEMANGLING_STRING_POOL_HPP_
+#define BOOST_DLL_DETAIL_DEMANGLING_STRING_POOL_HPP_
+
+#include <boost/dll/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/core/detail/string_view.hpp>
+
+namespace boost { namespace dll { namespace detail {
+
+///Null terminated string that is owned by a string_pool. Provides the read only part of the std::string interface.
+class pooled_string
+{
+    const char* data_ = "";
+    std::size_t size_ = 0;
+
+public:
+    static constexpr std::size_t npos = std::string::npos;
+
+    pooled_string() noexcept = default;
+    pooled_string(const char* data, std::size_t size) noexcept : data_(data), size_(size) {}
+
+    const char* data() const noexcept { return data_; }
+    const char* c_str() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+    std::size_t length() const noexcept { return size_; }
+    bool empty() const noexcept { return !size_; }
+    const char* begin() const noexcept { return data_; }
+    const char* end() const noexcept { return data_ + size_; }
+    char operator[](std::size_t i) const noexcept { return data_[i]; }
+
+    boost::core::string_view view() const noexcept { return boost::core::string_view(data_, size_); }
+    std::string str() const { return std::string(data_, size_); }
+
+    std::size_t find(boost::core::string_view s, std::size_t pos = 0) const noexcept { return view().find(s, pos); }
+    std::size_t find(char c, std::size_t pos = 0) const noexcept { return view().find(c, pos); }
+    std::size_t rfind(boost::core::string_view s, std::size_t pos = npos) const noexcept { return view().rfind(s, pos); }
+    std::size_t rfind(char c, std::size_t pos = npos) const noexcept { return view().rfind(c, pos); }
+    std::string substr(std::size_t pos = 0, std::size_t n = npos) const {
+        const auto v = view().substr(pos, n);
+        return std::string(v.data(), v.size());
+    }
+
+    operator boost::core::string_view() const noexcept { return view(); }
+    operator std::string() const { return str(); }
+
+    friend bool operator==(const pooled_string& lhs, const pooled_string& rhs) noexcept { return lhs.view() == rhs.view(); }
+    friend bool operator==(const pooled_string& lhs, boost::core::string_view rhs) noexcept { return lhs.view() == rhs; }
+    friend bool operator==(boost::core::string_view lhs, const pooled_string& rhs) noexcept { return lhs == rhs.view(); }
+    friend bool operator!=(const pooled_string& lhs, const pooled_string& rhs) noexcept { return !(lhs == rhs); }
+    friend bool operator!=(const pooled_string& lhs, boost::core::string_view rhs) noexcept { return !(lhs == rhs); }
+    friend bool operator!=(boost::core::string_view lhs, const pooled_string& rhs) noexcept { return !(lhs == rhs); }
+
+    friend std::ostream& operator<<(std::ostream& os, const pooled_string& s) {
+        return os.write(s.data(), static_cast<std::streamsize>(s.size()));
+    }
+};
+
+///Stores strings one after another in large chunks. Strings never move, until the pool is cleared or destroyed.
+class string_pool
+{
+    static constexpr std::size_t chunk_size = 64 * 1024;
+
+    std::vector<std::unique_ptr<char[]>> chunks_;
+    char* free_ = nullptr;
+    std::size_t free_size_ = 0;
+
+    char* allocate(std::size_t n)
+    {
+        if (n <= free_size_)
+        {
+            char* p = free_;
+            free_ += n;
+            free_size_ -= n;
+            return p;
+        }
+
+        // Long strings get their own chunk, keeping the free space of the current one
+        const bool own_chunk = (n > chunk_size / 4);
+        std::unique_ptr<char[]> chunk(new char[own_chunk ? n : chunk_size]);
+        chunks_.push_back(std::move(chunk));
+        char* p = chunks_.back().get();
+        if (!own_chunk)
+        {
+            free_ = p + n;
+            free_size_ = chunk_size - n;
+        }
+        return p;
+    }
+
+public:
+    string_pool() = default;
+    string_pool(string_pool&& other) noexcept
+        : chunks_(std::move(other.chunks_))
+        , free_(other.free_)
+        , free_size_(other.free_size_)
+    {
+        other.clear();
+    }
+    string_pool(const string_pool&) = delete;
+    string_pool& operator=(const string_pool&) = delete;
+
+    pooled_string add(boost::core::string_view s)
+    {
+        char* p = allocate(s.size() + 1);
+        std::memcpy(p, s.data(), s.size());
+        p[s.size()] = '\0';
+        return pooled_string(p, s.size());
+    }
+
+    ///Takes the ownership of the strings of the `other`
+    void splice(string_pool& other)
+    {
+        chunks_.reserve(chunks_.size() + other.chunks_.size());
+        for (auto & c : other.chunks_)
+            chunks_.push_back(std::move(c));
+        other.clear();
+    }
+
+    void swap(string_pool& other) noexcept
+    {
+        chunks_.swap(other.chunks_);
+        std::swap(free_, other.free_);
+        std::swap(free_size_, other.free_size_);
+    }
+
+    void clear() noexcept
+    {
+        chunks_.clear();
+        free_ = nullptr;
+        free_size_ = 0;
+    }
+};
+
+}}}
+
+#endif /* BOOST_DLL_DETAIL_DEMANGLING_STRING_POOL_HPP_ */
@@ -14,11 +14,16 @@
 # pragma once
 #endif
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
-#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
 #include <vector>
 
+#include <boost/dll/detail/binary_source.hpp>
+#include <boost/dll/symbol_info.hpp>
 #include <boost/throw_exception.hpp>
 
 namespace boost { namespace dll { namespace detail {
@@ -92,36 +97,67 @@ struct Elf_Sym_template<std::uint64_t> {
 using Elf32_Sym_ = Elf_Sym_template<std::uint32_t>;
 using Elf64_Sym_ = Elf_Sym_template<std::uint64_t>;
 
+template <class AddressOffsetT>
+struct Elf_Dyn_template {
+  typename std::make_signed<AddressOffsetT>::type d_tag;  /* Dynamic entry type */
+  AddressOffsetT  d_val;                                  /* Integer or address value */
+};
+
+using Elf32_Dyn_ = Elf_Dyn_template<std::uint32_t>;
+using Elf64_Dyn_ = Elf_Dyn_template<std::uint64_t>;
+
 template <class AddressOffsetT>
 class elf_info {
     using header_t = boost::dll::detail::Elf_Ehdr_template<AddressOffsetT>;
     using section_t= boost::dll::detail::Elf_Shdr_template<AddressOffsetT>;
     using symbol_t = boost::dll::detail::Elf_Sym_template<AddressOffsetT>;
+    using dynamic_t = boost::dll::detail::Elf_Dyn_template<AddressOffsetT>;
 
     static constexpr std::uint32_t SHT_SYMTAB_ = 2;
     static constexpr std::uint32_t SHT_STRTAB_ = 3;
+    static constexpr std::uint32_t SHT_HASH_ = 5;
+    static constexpr std::uint32_t SHT_DYNAMIC_ = 6;
     static constexpr std::uint32_t SHT_DYNSYM_ = 11;
+    static constexpr std::uint32_t SHT_GNU_HASH_ = 0x6ffffff6;
 
     static constexpr unsigned char STB_LOCAL_ = 0;   /* Local symbol */
     static constexpr unsigned char STB_GLOBAL_ = 1;  /* Global symbol */
     static constexpr unsigned char STB_WEAK_ = 2;    /* Weak symbol */
 
+    static constexpr unsigned char STT_OBJECT_ = 1;     /* Symbol is a data object */
+    static constexpr unsigned char STT_FUNC_ = 2;       /* Symbol is a code object */
+    static constexpr unsigned char STT_COMMON_ = 5;     /* Symbol is a common data object */
+    static constexpr unsigned char STT_TLS_ = 6;        /* Symbol is thread-local data object*/
+    static constexpr unsigned char STT_GNU_IFUNC_ = 10; /* Symbol is indirect code object */
+
+    static constexpr std::int32_t DT_NULL_ = 0;         /* Marks end of dynamic section */
+    static constexpr std::int32_t DT_NEEDED_ = 1;       /* Name of needed library */
+
     /* Symbol visibility specification encoded in the st_other field.  */
     static constexpr unsigned char STV_DEFAULT_ = 0;      /* Default symbol visibility rules */
     static constexpr unsigned char STV_INTERNAL_ = 1;     /* Processor specific hidden class */
     static constexpr unsigned char STV_HIDDEN_ = 2;       /* Sym unavailable in other modules */
     static constexpr unsigned char STV_PROTECTED_ = 3;    /* Not preemptible, not exported */
 
+    // Returns a null terminated string from the `table` or an empty string if `offset` is out of range.
+    static boost::core::string_view name_at(boost::core::string_view table, std::size_t offset) noexcept {
+        if (offset >= table.size()) {
+            return boost::core::string_view();
+        }
+
+        table = table.substr(offset);
+        return table.substr(0, table.find('\0'));
+    }
+
 public:
-    static bool parsing_supported(std::ifstream& fs) {
+    static bool parsing_supported(binary_source& fs) {
         const unsigned char magic_bytes[5] = { 
             0x7f, 'E', 'L', 'F', sizeof(std::uint32_t) == sizeof(AddressOffsetT) ? 1 : 2
         };
 
         unsigned char ch;
-        fs.seekg(0);
         for (std::size_t i = 0; i < sizeof(magic_bytes); ++i) {
-            fs >> ch;
+            fs.read(i, ch);
             if (ch != magic_bytes[i]) {
                 return false;
             }
@@ -130,76 +166,84 @@ public:
         return true;
     }
 
-    static std::vector<std::string> sections(std::ifstream& fs) {
-        std::vector<std::string> ret;
-        std::vector<char> names;
-        sections_names_raw(fs, names);
-
-        const char* name_begin = &names[0];
-        const char* const name_end = name_begin + names.size();
-        ret.reserve(header(fs).e_shnum);
-        do {
-            if (*name_begin) {
-                ret.push_back(name_begin);
-                name_begin += ret.back().size() + 1;
-            } else {
-                ++name_begin;
-            }
-        } while (name_begin != name_end);
-
-        return ret;
-    }
+    // Calls `bool f(boost::core::string_view name)` for each section name while `f` returns true.
+    // Returns false if the iteration was stopped by `f`.
+    template <class F>
+    static bool for_each_section(binary_source& fs, F f) {
+        boost::core::string_view names = cache(fs).names;
 
-private:
-    template <class Integer>
-    static void checked_seekg(std::ifstream& fs, Integer pos) {
-        if (pos < 0) {
-            boost::throw_exception(std::runtime_error("Integral underflow while getting info from ELF file"));
-        }
-        if (static_cast<std::streamoff>(pos) < 0) {
-            boost::throw_exception(std::runtime_error("Integral overflow while getting info from ELF file"));
+        while (!names.empty()) {
+            const boost::core::string_view name = name_at(names, 0);
+            if (!name.empty() && !f(name)) {
+                return false;
+            }
+            names.remove_prefix((std::min)(name.size() + 1, names.size()));
         }
 
-        // `seekg` will throw exceptions on an attempt to get outsize of the
-        // file size.
-        fs.seekg(static_cast<std::streamoff>(pos));
+        return true;
     }
 
-    template <class T>
-    static void read_raw(std::ifstream& fs, T& value, std::size_t size = sizeof(T)) {
-        fs.read(reinterpret_cast<char*>(&value), size);
+    static std::vector<std::string> sections(binary_source& fs) {
+        std::vector<std::string> ret;
+        ret.reserve(cache(fs).sections.size());
+        for_each_section(fs, [&ret](boost::core::string_view name) {
+            ret.emplace_back(name.data(), name.size());
+            return true;
+        });
+        return ret;
     }
 
-    static header_t header(std::ifstream& fs) {
-        header_t elf;
-
-        fs.seekg(0);
-        read_raw(fs, elf);
+private:
+    // Header, section table and section names table are parsed once per `binary_source`.
+    struct cache_t: binary_source::cache_base {
+        header_t                    elf;
+        std::vector<section_t>      sections;
+        std::vector<char>           names_buffer;
+        boost::core::string_view    names;
+    };
+
+    static const cache_t& cache(binary_source& fs) {
+        return fs.cached<cache_t>([&fs](cache_t& c) {
+            fs.read(0, c.elf);
+
+            c.sections.resize(c.elf.e_shnum);
+            if (!c.sections.empty()) {
+                fs.read(c.elf.e_shoff, c.sections[0], c.sections.size() * sizeof(section_t));
+            }
 
-        return elf;
+            section_t section_names_section;
+            if (c.elf.e_shstrndx < c.sections.size()) {
+                section_names_section = c.sections[c.elf.e_shstrndx];
+            } else {
+                fs.read(c.elf.e_shoff + c.elf.e_shstrndx * sizeof(section_t), section_names_section);
+            }
+            c.names = fs.data(section_names_section.sh_offset, section_names_section.sh_size, c.names_buffer);
+        });
     }
 
-    static void sections_names_raw(std::ifstream& fs, std::vector<char>& sections) {
-        const header_t elf = header(fs);
+    struct symbols_table {
+        boost::core::string_view    symbols;
+        boost::core::string_view    text;
 
-        section_t section_names_section;
-        checked_seekg(fs, elf.e_shoff + elf.e_shstrndx * sizeof(section_t));
-        read_raw(fs, section_names_section);
+        std::size_t size() const noexcept {
+            return symbols.size() / sizeof(symbol_t);
+        }
 
-        sections.resize(static_cast<std::size_t>(section_names_section.sh_size) + 1, '\0');
-        checked_seekg(fs, section_names_section.sh_offset);
-        read_raw(fs, sections[0], static_cast<std::size_t>(section_names_section.sh_size));
-    }
+        symbol_t operator[](std::size_t i) const noexcept {
+            // Copying to avoid unaligned reads from memory mapped files
+            symbol_t sym;
+            std::memcpy(&sym, symbols.data() + i * sizeof(symbol_t), sizeof(symbol_t));
+            return sym;
+        }
 
-    static void symbols_text(std::ifstream& fs, std::vector<symbol_t>& symbols, std::vector<char>& text) {
-        std::vector<char> names;
-        sections_names_raw(fs, names);
-        symbols_text(fs, symbols, text, names);
-    }
+        boost::core::string_view name(const symbol_t& sym) const noexcept {
+            return name_at(text, sym.st_name);
+        }
+    };
 
-    static void symbols_text(std::ifstream& fs, std::vector<symbol_t>& symbols, std::vector<char>& text, const std::vector<char>& names) {
-        const header_t elf = header(fs);
-        checked_seekg(fs, elf.e_shoff);
+    static symbols_table symbols_text(binary_source& fs, std::vector<char>& symbols_buffer, std::vector<char>& text_buffer) {
+        const cache_t& c = cache(fs);
+        const boost::core::string_view names = c.names;
 
         // ".dynsym" section may not have info on symbols that could be used while self loading an executable,
         // so we prefer ".symtab" section.
@@ -213,26 +257,24 @@ private:
         AddressOffsetT dynstr_size = 0;
         AddressOffsetT dynstr_offset = 0;
 
-        for (std::size_t i = 0; i < elf.e_shnum; ++i) {
-            section_t section;
-            read_raw(fs, section);
+        for (const section_t& section : c.sections) {
             if (section.sh_name >= names.size()) {
                 continue;
             }
-            const char* name = &names[section.sh_name];
+            const boost::core::string_view name = name_at(names, section.sh_name);
 
-            if (section.sh_type == SHT_SYMTAB_ && !std::strcmp(name, ".symtab")) {
+            if (section.sh_type == SHT_SYMTAB_ && name == ".symtab") {
                 symtab_size = section.sh_size;
                 symtab_offset = section.sh_offset;
             } else if (section.sh_type == SHT_STRTAB_) {
-                if (!std::strcmp(name, ".dynstr")) {
+                if (name == ".dynstr") {
                     dynstr_size = section.sh_size;
                     dynstr_offset = section.sh_offset;
-                } else if (!std::strcmp(name, ".strtab")) {
+                } else if (name == ".strtab") {
                     strtab_size = section.sh_size;
                     strtab_offset = section.sh_offset;
                 }
-            } else if (section.sh_type == SHT_DYNSYM_ && !std::strcmp(name, ".dynsym")) {
+            } else if (section.sh_type == SHT_DYNSYM_ && name == ".dynsym") {
                 dynsym_size = section.sh_size;
                 dynsym_offset = section.sh_offset;
             }
@@ -246,17 +288,14 @@ private:
             strtab_offset = dynstr_offset;
         }
 
+        symbols_table ret;
         if (!symtab_size || !strtab_size) {
-            return;
+            return ret;
         }
 
-        text.resize(static_cast<std::size_t>(strtab_size) + 1, '\0');
-        checked_seekg(fs, strtab_offset);
-        read_raw(fs, text[0], static_cast<std::size_t>(strtab_size));
-
-        symbols.resize(static_cast<std::size_t>(symtab_size / sizeof(symbol_t)));
-        checked_seekg(fs, symtab_offset);
-        read_raw(fs, symbols[0], static_cast<std::size_t>(symtab_size - (symtab_size % sizeof(symbol_t))) );
+        ret.text = fs.data(strtab_offset, strtab_size, text_buffer);
+        ret.symbols = fs.data(symtab_offset, symtab_size - (symtab_size % sizeof(symbol_t)), symbols_buffer);
+        return ret;
     }
 
     static bool is_visible(const symbol_t& sym) noexcept {
@@ -267,73 +306,332 @@ private:
                 && (sym.st_info >> 4) != STB_LOCAL_ && !!sym.st_size;
     }
 
-public:
-    static std::vector<std::string> symbols(std::ifstream& fs) {
-        std::vector<std::string> ret;
+    static boost::dll::symbol_info to_symbol_info(const symbol_t& sym, boost::core::string_view name) noexcept {
+        boost::dll::symbol_info ret;
+        ret.name = name;
+        ret.address = sym.st_value;
+        ret.size = sym.st_size;
+
+        switch (sym.st_info & 0xf) {
+        case STT_FUNC_:
+        case STT_GNU_IFUNC_:
+            ret.type = boost::dll::symbol_type::function;
+            break;
+        case STT_OBJECT_:
+        case STT_COMMON_:
+            ret.type = boost::dll::symbol_type::object;
+            break;
+        case STT_TLS_:
+            ret.type = boost::dll::symbol_type::tls;
+            break;
+        default:
+            ret.type = boost::dll::symbol_type::unknown;
+        }
 
-        std::vector<symbol_t> symbols;
-        std::vector<char>   text;
-        symbols_text(fs, symbols, text);
+        ret.binding = ((sym.st_info >> 4) == STB_WEAK_ ? boost::dll::symbol_binding::weak : boost::dll::symbol_binding::global);
+        return ret;
+    }
 
-        ret.reserve(symbols.size());
-        for (std::size_t i = 0; i < symbols.size(); ++i) {
-            if (is_visible(symbols[i]) && symbols[i].st_name < text.size()) {
-                ret.push_back(&text[symbols[i].st_name]);
-                if (ret.back().empty()) {
-                    ret.pop_back(); // Do not show empty names
-                }
+    enum class lookup_result { found, not_found, no_hash_table };
+
+    static std::uint32_t gnu_hash(boost::core::string_view name) noexcept {
+        std::uint32_t h = 5381;
+        for (const char c : name) {
+            h = h * 33 + static_cast<unsigned char>(c);
+        }
+        return h;
+    }
+
+    static std::uint32_t sysv_hash(boost::core::string_view name) noexcept {
+        std::uint32_t h = 0;
+        for (const char c : name) {
+            h = (h << 4) + static_cast<unsigned char>(c);
+            const std::uint32_t g = h & 0xf0000000;
+            h ^= g >> 24;
+            h &= ~g;
+        }
+        return h;
+    }
+
+    // Checks the symbol with index `index` from the symbol table `symtab` linked with the string table.
+    // Returns true if the symbol is visible and has the name `name`.
+    static bool symbol_matches(binary_source& fs, const section_t& symtab, std::uint64_t index,
+        boost::core::string_view name, std::string& buffer)
+    {
+        if (index >= symtab.sh_size / sizeof(symbol_t)) {
+            boost::throw_exception(std::out_of_range("Symbol index is out of range while getting info from ELF file"));
+        }
+
+        const cache_t& c = cache(fs);
+        if (symtab.sh_link >= c.sections.size()) {
+            boost::throw_exception(std::out_of_range("String table index is out of range while getting info from ELF file"));
+        }
+
+        symbol_t sym;
+        fs.read(symtab.sh_offset + index * sizeof(symbol_t), sym);
+        return is_visible(sym) && fs.c_str(c.sections[symtab.sh_link].sh_offset + sym.st_name, buffer) == name;
+    }
+
+    // Lookup using the ".gnu.hash" section layout: nbuckets, symoffset, bloom_size, bloom_shift,
+    // bloom[bloom_size], buckets[nbuckets], chain[].
+    static lookup_result gnu_hash_lookup(binary_source& fs, const section_t& hash, const section_t& symtab,
+        boost::core::string_view name)
+    {
+        std::uint32_t nbuckets, symoffset, bloom_size, bloom_shift;
+        fs.read(hash.sh_offset, nbuckets);
+        fs.read(hash.sh_offset + 4, symoffset);
+        fs.read(hash.sh_offset + 8, bloom_size);
+        fs.read(hash.sh_offset + 12, bloom_shift);
+        if (!nbuckets || !bloom_size) {
+            return lookup_result::no_hash_table;
+        }
+
+        const std::uint32_t h = gnu_hash(name);
+        constexpr std::uint32_t bits = sizeof(AddressOffsetT) * 8;
+        const std::uint64_t bloom_offset = hash.sh_offset + 16;
+
+        AddressOffsetT bloom_word;
+        fs.read(bloom_offset + ((h / bits) % bloom_size) * sizeof(AddressOffsetT), bloom_word);
+        const AddressOffsetT mask = (static_cast<AddressOffsetT>(1) << (h % bits))
+            | (static_cast<AddressOffsetT>(1) << ((h >> bloom_shift) % bits));
+        if ((bloom_word & mask) != mask) {
+            return lookup_result::not_found;
+        }
+
+        const std::uint64_t buckets_offset = bloom_offset + static_cast<std::uint64_t>(bloom_size) * sizeof(AddressOffsetT);
+        const std::uint64_t chain_offset = buckets_offset + static_cast<std::uint64_t>(nbuckets) * 4;
+
+        std::uint32_t index;
+        fs.read(buckets_offset + (h % nbuckets) * 4, index);
+        if (index < symoffset) {
+            return lookup_result::not_found;
+        }
+
+        std::string buffer;
+        for (;; ++index) {
+            std::uint32_t chain_hash;
+            fs.read(chain_offset + static_cast<std::uint64_t>(index - symoffset) * 4, chain_hash);
+            if ((h | 1) == (chain_hash | 1) && symbol_matches(fs, symtab, index, name, buffer)) {
+                return lookup_result::found;
+            }
+
+            if (chain_hash & 1) { // end of chain
+                return lookup_result::not_found;
             }
         }
+    }
 
-        return ret;
+    // Lookup using the ".hash" section layout: nbucket, nchain, bucket[nbucket], chain[nchain].
+    static lookup_result sysv_hash_lookup(binary_source& fs, const section_t& hash, const section_t& symtab,
+        boost::core::string_view name)
+    {
+        std::uint32_t nbucket, nchain;
+        fs.read(hash.sh_offset, nbucket);
+        fs.read(hash.sh_offset + 4, nchain);
+        if (!nbucket) {
+            return lookup_result::no_hash_table;
+        }
+
+        const std::uint64_t buckets_offset = hash.sh_offset + 8;
+        const std::uint64_t chain_offset = buckets_offset + static_cast<std::uint64_t>(nbucket) * 4;
+
+        std::uint32_t index;
+        fs.read(buckets_offset + (sysv_hash(name) % nbucket) * 4, index);
+
+        std::string buffer;
+        // Each symbol could appear in a chain only once, `nchain` protects from loops in broken binaries
+        for (std::uint32_t i = 0; index != 0 && i < nchain; ++i) {
+            if (symbol_matches(fs, symtab, index, name, buffer)) {
+                return lookup_result::found;
+            }
+            fs.read(chain_offset + static_cast<std::uint64_t>(index) * 4, index);
+        }
+
+        return lookup_result::not_found;
     }
 
-    static std::vector<std::string> symbols(std::ifstream& fs, const char* section_name) {
-        std::vector<std::string> ret;
-        
-        std::size_t index = 0;
-        std::size_t ptrs_in_section_count = 0;
+    static lookup_result hash_lookup(binary_source& fs, boost::core::string_view name) {
+        const cache_t& c = cache(fs);
 
-        std::vector<char> names;
-        sections_names_raw(fs, names);
+        const section_t* gnu_hash_section = nullptr;
+        const section_t* sysv_hash_section = nullptr;
+        for (const section_t& section : c.sections) {
+            if (section.sh_type == SHT_GNU_HASH_) {
+                gnu_hash_section = &section;
+            } else if (section.sh_type == SHT_HASH_) {
+                sysv_hash_section = &section;
+            }
+        }
 
-        const header_t elf = header(fs);
+        // Hash table is linked with the symbol table that it indexes
+        if (gnu_hash_section && gnu_hash_section->sh_link < c.sections.size()) {
+            return gnu_hash_lookup(fs, *gnu_hash_section, c.sections[gnu_hash_section->sh_link], name);
+        }
 
-        for (; index < elf.e_shnum; ++index) {
-            section_t section;
-            checked_seekg(fs, elf.e_shoff + index * sizeof(section_t));
-            read_raw(fs, section);
+        if (sysv_hash_section && sysv_hash_section->sh_link < c.sections.size()) {
+            return sysv_hash_lookup(fs, *sysv_hash_section, c.sections[sysv_hash_section->sh_link], name);
+        }
 
-            if (!std::strcmp(&names.at(section.sh_name), section_name)) {
-                if (!section.sh_entsize) {
-                    section.sh_entsize = 1;
-                }
-                ptrs_in_section_count = static_cast<std::size_t>(section.sh_size / section.sh_entsize);
-                break;
+        return lookup_result::no_hash_table;
+    }
+
+    static bool has_symtab(binary_source& fs) {
+        const cache_t& c = cache(fs);
+        for (const section_t& section : c.sections) {
+            if (section.sh_type == SHT_SYMTAB_ && section.sh_name < c.names.size()
+                && name_at(c.names, section.sh_name) == ".symtab")
+            {
+                return true;
             }
         }
 
-        std::vector<symbol_t> symbols;
-        std::vector<char> text;
-        symbols_text(fs, symbols, text, names);
-    
-        if (ptrs_in_section_count < symbols.size()) {
-            ret.reserve(ptrs_in_section_count);
-        } else {
-            ret.reserve(symbols.size());
+        return false;
+    }
+
+public:
+    // Calls `bool f(const boost::dll::symbol_info& info)` for each visible symbol while `f` returns true.
+    // Returns false if the iteration was stopped by `f`.
+    template <class F>
+    static bool for_each_symbol_info(binary_source& fs, F f) {
+        std::vector<char> symbols_buffer;
+        std::vector<char> text_buffer;
+        const symbols_table symbols = symbols_text(fs, symbols_buffer, text_buffer);
+
+        for (std::size_t i = 0; i < symbols.size(); ++i) {
+            const symbol_t sym = symbols[i];
+            const boost::core::string_view name = symbols.name(sym);
+            if (is_visible(sym) && !name.empty() && !f(to_symbol_info(sym, name))) { // Do not show empty names
+                return false;
+            }
         }
 
+        return true;
+    }
+
+    // Calls `bool f(boost::core::string_view name)` for each visible symbol while `f` returns true.
+    // Returns false if the iteration was stopped by `f`.
+    template <class F>
+    static bool for_each_symbol(binary_source& fs, F f) {
+        return for_each_symbol_info(fs, [&f](const boost::dll::symbol_info& info) {
+            return f(info.name);
+        });
+    }
+
+    // Calls `bool f(boost::core::string_view name)` for each visible symbol from the section `section_name` while `f` returns true.
+    // Returns false if the iteration was stopped by `f`.
+    template <class F>
+    static bool for_each_symbol(binary_source& fs, const char* section_name, F f) {
+        const cache_t& c = cache(fs);
+
+        std::size_t index = 0;
+        for (; index < c.sections.size(); ++index) {
+            const section_t& section = c.sections[index];
+            if (section.sh_name >= c.names.size()) {
+                boost::throw_exception(std::out_of_range("Section name is out of range while getting info from ELF file"));
+            }
+
+            if (name_at(c.names, section.sh_name) == section_name) {
+                break;
+            }
+        }
+
+        std::vector<char> symbols_buffer;
+        std::vector<char> text_buffer;
+        const symbols_table symbols = symbols_text(fs, symbols_buffer, text_buffer);
+
         for (std::size_t i = 0; i < symbols.size(); ++i) {
-            if (symbols[i].st_shndx == index && is_visible(symbols[i]) && symbols[i].st_name < text.size()) {
-                ret.push_back(&text[symbols[i].st_name]);
-                if (ret.back().empty()) {
-                    ret.pop_back(); // Do not show empty names
+            const symbol_t sym = symbols[i];
+            const boost::core::string_view name = symbols.name(sym);
+            if (sym.st_shndx == index && is_visible(sym) && !name.empty() && !f(name)) { // Do not show empty names
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static std::vector<std::string> symbols(binary_source& fs) {
+        std::vector<std::string> ret;
+        for_each_symbol(fs, [&ret](boost::core::string_view name) {
+            ret.emplace_back(name.data(), name.size());
+            return true;
+        });
+        return ret;
+    }
+
+    static std::vector<std::string> symbols(binary_source& fs, const char* section_name) {
+        std::vector<std::string> ret;
+        for_each_symbol(fs, section_name, [&ret](boost::core::string_view name) {
+            ret.emplace_back(name.data(), name.size());
+            return true;
+        });
+        return ret;
+    }
+
+    // Calls `bool f(boost::core::string_view name)` for each DT_NEEDED entry of the ".dynamic" section while `f`
+    // returns true. Returns false if the iteration was stopped by `f`.
+    template <class F>
+    static bool for_each_dependency(binary_source& fs, F f) {
+        const cache_t& c = cache(fs);
+        for (const section_t& section : c.sections) {
+            if (section.sh_type != SHT_DYNAMIC_ || section.sh_link >= c.sections.size()) {
+                continue;
+            }
+
+            // Dynamic section is linked with the string table that holds the names
+            const section_t& strtab = c.sections[section.sh_link];
+            std::vector<char> dynamic_buffer;
+            std::vector<char> text_buffer;
+            const boost::core::string_view dynamic = fs.data(section.sh_offset, section.sh_size - (section.sh_size % sizeof(dynamic_t)), dynamic_buffer);
+            const boost::core::string_view text = fs.data(strtab.sh_offset, strtab.sh_size, text_buffer);
+
+            for (std::size_t i = 0; i < dynamic.size() / sizeof(dynamic_t); ++i) {
+                // Copying to avoid unaligned reads from memory mapped files
+                dynamic_t entry;
+                std::memcpy(&entry, dynamic.data() + i * sizeof(dynamic_t), sizeof(dynamic_t));
+                if (entry.d_tag == DT_NULL_) {
+                    break;
+                }
+
+                if (entry.d_tag == DT_NEEDED_) {
+                    const boost::core::string_view name = name_at(text, static_cast<std::size_t>(entry.d_val));
+                    if (!name.empty() && !f(name)) {
+                        return false;
+                    }
                 }
             }
         }
 
+        return true;
+    }
+
+    static std::vector<std::string> dependencies(binary_source& fs) {
+        std::vector<std::string> ret;
+        for_each_dependency(fs, [&ret](boost::core::string_view name) {
+            ret.emplace_back(name.data(), name.size());
+            return true;
+        });
         return ret;
     }
+
+    // Returns true if the visible symbol `name` exists. Uses ".gnu.hash" or ".hash" sections if they exist
+    // and falls back to the linear search otherwise. Hash tables index only the ".dynsym" section, while
+    // the ".symtab" section (if any) has more symbols that are reported by `symbols()`. Those are searched
+    // linearly only if `search_symtab` is true.
+    static bool has_symbol(binary_source& fs, boost::core::string_view name, bool search_symtab) {
+        const lookup_result res = hash_lookup(fs, name);
+        if (res == lookup_result::found) {
+            return true;
+        }
+
+        if (res == lookup_result::not_found && (!search_symtab || !has_symtab(fs))) {
+            return false;
+        }
+
+        return !for_each_symbol(fs, [name](boost::core::string_view symbol) {
+            return symbol != name;
+        });
+    }
 };
 
 using elf_info32 = elf_info<std::uint32_t> ;
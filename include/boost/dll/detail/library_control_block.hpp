@@ -0,0 +1,176 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_LIBRARY_CONTROL_BLOCK_HPP
+#define BOOST_DLL_DETAIL_LIBRARY_CONTROL_BLOCK_HPP
+
+#include <boost/dll/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <new>
+
+namespace boost { namespace dll { namespace detail {
+
+// Insert-only map from symbol names to their addresses. Readers take no locks, writers publish
+// fully constructed nodes with a CAS on the bucket head. Nodes live as long as the map.
+class symbol_cache {
+    struct node {
+        node*           next;
+        void*           address;
+        std::size_t     hash;
+        std::size_t     size;
+
+        // Name is stored right after the node
+        const char* name() const noexcept {
+            return reinterpret_cast<const char*>(this + 1);
+        }
+    };
+
+    static constexpr std::size_t buckets_count = 64;
+    std::atomic<node*> buckets_[buckets_count];
+
+    static std::size_t hash_and_size(const char* name, std::size_t& size) noexcept {
+        std::size_t h = static_cast<std::size_t>(2166136261u);
+        const char* p = name;
+        for (; *p; ++p) {
+            h = (h ^ static_cast<unsigned char>(*p)) * static_cast<std::size_t>(16777619u);
+        }
+        size = static_cast<std::size_t>(p - name);
+        return h;
+    }
+
+    static void* find(const node* n, std::size_t hash, const char* name, std::size_t size) noexcept {
+        for (; n; n = n->next) {
+            if (n->hash == hash && n->size == size && !std::memcmp(n->name(), name, size)) {
+                return n->address;
+            }
+        }
+        return nullptr;
+    }
+
+public:
+    symbol_cache() noexcept {
+        for (std::atomic<node*>& b : buckets_) {
+            b.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    symbol_cache(const symbol_cache&) = delete;
+    symbol_cache& operator=(const symbol_cache&) = delete;
+
+    ~symbol_cache() {
+        for (std::atomic<node*>& b : buckets_) {
+            node* n = b.load(std::memory_order_relaxed);
+            while (n) {
+                node* const next = n->next;
+                n->~node();
+                ::operator delete(n);
+                n = next;
+            }
+        }
+    }
+
+    // Returns the cached address of the symbol or remembers and returns the non-null result of `resolve()`.
+    template <class F>
+    void* find_or_insert(const char* name, F resolve) noexcept {
+        std::size_t size;
+        const std::size_t hash = hash_and_size(name, size);
+        std::atomic<node*>& bucket = buckets_[hash % buckets_count];
+
+        node* head = bucket.load(std::memory_order_acquire);
+        if (void* const address = find(head, hash, name, size)) {
+            return address;
+        }
+
+        void* const address = resolve();
+        if (!address) {
+            return nullptr;
+        }
+
+        void* const memory = ::operator new(sizeof(node) + size + 1, std::nothrow);
+        if (!memory) {
+            return address; // not caching on memory shortage
+        }
+        node* const n = new (memory) node{nullptr, address, hash, size};
+        std::memcpy(const_cast<char*>(n->name()), name, size + 1);
+
+        n->next = head;
+        while (!bucket.compare_exchange_weak(n->next, n, std::memory_order_release, std::memory_order_acquire)) {
+            if (find(n->next, hash, name, size)) {
+                // Other thread cached the same symbol
+                n->~node();
+                ::operator delete(memory);
+                break;
+            }
+        }
+
+        return address;
+    }
+};
+
+// State shared by all the shared_library instances that are copies of each other. Copying
+// increments the `refs_` instead of recovering the path and loading the library once more.
+// The native handle is closed when the last reference is released. Addresses of the symbols
+// requested through any of the copies are cached in `symbols_`, unless the handle looks up the
+// symbols in the global scope, where the results change as libraries are loaded and unloaded.
+class library_control_block {
+    std::atomic<std::size_t> refs_;
+    const bool cache_symbols_;
+    symbol_cache symbols_;
+
+    explicit library_control_block(bool cache_symbols) noexcept
+        : refs_(1)
+        , cache_symbols_(cache_symbols)
+    {}
+
+    ~library_control_block() = default;
+
+public:
+    library_control_block(const library_control_block&) = delete;
+    library_control_block& operator=(const library_control_block&) = delete;
+
+    // Returns nullptr if there is not enough memory. Copies of such libraries are made by path.
+    static library_control_block* create(bool cache_symbols = true) noexcept {
+        return new (std::nothrow) library_control_block(cache_symbols);
+    }
+
+    void add_ref() noexcept {
+        refs_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool caches_symbols() const noexcept {
+        return cache_symbols_;
+    }
+
+    symbol_cache& symbols() noexcept {
+        return symbols_;
+    }
+
+    std::size_t use_count() const noexcept {
+        return refs_.load(std::memory_order_relaxed);
+    }
+
+    // Returns true if the last reference was released and the native handle must be closed.
+    bool release() noexcept {
+        if (refs_.fetch_sub(1, std::memory_order_release) != 1) {
+            return false;
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        delete this;
+        return true;
+    }
+};
+
+}}} // boost::dll::detail
+
+#endif // BOOST_DLL_DETAIL_LIBRARY_CONTROL_BLOCK_HPP
@@ -14,12 +14,13 @@
 # pragma once
 #endif
 
-#include <algorithm>
 #include <cstdint>
-#include <fstream>
-#include <string> // for std::getline
+#include <string>
 #include <vector>
 
+#include <boost/dll/detail/binary_source.hpp>
+#include <boost/dll/symbol_info.hpp>
+
 namespace boost { namespace dll { namespace detail {
 
 using integer_t = int;
@@ -144,6 +145,15 @@ struct symtab_command_ {
     std::uint32_t    strsize;    /* string table size in bytes */
 };
 
+struct dylib_command_ {
+    std::uint32_t    cmd;                    /* LC_LOAD_DYLIB_, LC_LOAD_WEAK_DYLIB_, LC_REEXPORT_DYLIB_ */
+    std::uint32_t    cmdsize;                /* includes pathname string */
+    std::uint32_t    name_offset;            /* library's path name, offset from the start of the command */
+    std::uint32_t    timestamp;              /* library's build time stamp */
+    std::uint32_t    current_version;        /* library's current version number */
+    std::uint32_t    compatibility_version;  /* library's compatibility vers number*/
+};
+
 template <class AddressOffsetT>
 struct nlist_template {
     std::uint32_t     n_strx;
@@ -168,76 +178,119 @@ class macho_info {
     static constexpr std::uint32_t SEGMENT_CMD_NUMBER = (sizeof(AddressOffsetT) > 4 ? load_command_types::LC_SEGMENT_64_ : load_command_types::LC_SEGMENT_);
 
 public:
-    static bool parsing_supported(std::ifstream& fs) {
+    static bool parsing_supported(binary_source& fs) {
         static const uint32_t magic_bytes = (sizeof(AddressOffsetT) <= sizeof(uint32_t) ? 0xfeedface : 0xfeedfacf);
 
         uint32_t magic;
-        fs.seekg(0);
-        fs.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+        fs.read(0, magic);
         return (magic_bytes == magic);
     }
 
 private:
-    template <class T>
-    static void read_raw(std::ifstream& fs, T& value, std::size_t size = sizeof(T)) {
-        fs.read(reinterpret_cast<char*>(&value), size);
+    struct command_position {
+        std::uint32_t   cmd;
+        std::uint64_t   pos;
+    };
+
+    // Header and load commands positions are parsed once per `binary_source`.
+    struct cache_t: binary_source::cache_base {
+        header_t                        h;
+        std::vector<command_position>   commands;
+    };
+
+    static const cache_t& cache(binary_source& fs) {
+        return fs.cached<cache_t>([&fs](cache_t& c) {
+            fs.read(0, c.h);
+
+            load_command_t command;
+            std::uint64_t pos = sizeof(header_t);
+            for (std::size_t i = 0; i < c.h.ncmds; ++i) {
+                fs.read(pos, command);
+                if (command.cmdsize < sizeof(load_command_t)) {
+                    break; // Broken binary, the following commands could not be located
+                }
+                c.commands.push_back(command_position{command.cmd, pos});
+                pos += command.cmdsize;
+            }
+        });
     }
 
+    // Calls `callback_f` for each load command `cmd_num` while it returns true
     template <class F>
-    static void command_finder(std::ifstream& fs, uint32_t cmd_num, F callback_f) {
-        const header_t h = header(fs);
-        load_command_t command;
-        fs.seekg(sizeof(header_t));
-        for (std::size_t i = 0; i < h.ncmds; ++i) {
-            const std::ifstream::pos_type pos = fs.tellg();
-            read_raw(fs, command);
-            if (command.cmd != cmd_num) {
-                fs.seekg(pos + static_cast<std::ifstream::pos_type>(command.cmdsize));
-                continue;
+    static bool command_finder(binary_source& fs, uint32_t cmd_num, F callback_f) {
+        for (const command_position& command : cache(fs).commands) {
+            if (command.cmd == cmd_num && !callback_f(fs, command.pos)) {
+                return false;
             }
-
-            fs.seekg(pos);
-            callback_f(fs);
-            fs.seekg(pos + static_cast<std::ifstream::pos_type>(command.cmdsize));
         }
+
+        return true;
     }
 
+    template <class F>
     struct section_names_gather {
-        std::vector<std::string>&       ret;
+        F&      f;
 
-        void operator()(std::ifstream& fs) const {
+        bool operator()(binary_source& fs, std::uint64_t pos) const {
             segment_t segment;
-            read_raw(fs, segment);
+            fs.read(pos, segment);
+            pos += sizeof(segment);
 
             section_t section;
-            ret.reserve(ret.size() + segment.nsects);
             for (std::size_t j = 0; j < segment.nsects; ++j) {
-                read_raw(fs, section);
+                fs.read(pos + j * sizeof(section), section);
                 // `segname` goes right after the `sectname`.
                 // Forcing `sectname` to end on '\0'
                 section.segname[0] = '\0';
-                ret.push_back(section.sectname);
-                if (ret.back().empty()) {
-                    ret.pop_back(); // Do not show empty names
+                const boost::core::string_view name(section.sectname);
+                if (!name.empty() && !f(name)) { // Do not show empty names
+                    return false;
                 }
             }
+
+            return true;
         }
     };
 
-    struct symbol_names_gather {
-        std::vector<std::string>&       ret;
-        std::size_t                     section_index;
+    // Calls `bool f(const boost::dll::symbol_info& info)`. Symbol types are deduced from the
+    // `section_flags` if they are provided.
+    template <class F>
+    struct symbols_gather {
+        F&                                  f;
+        std::size_t                         section_index;
+        const std::vector<std::uint32_t>*   section_flags;
+
+        boost::dll::symbol_type type_of(std::uint8_t n_sect) const noexcept {
+            static constexpr std::uint32_t SECTION_TYPE_ = 0x000000ff;
+            static constexpr std::uint32_t S_THREAD_LOCAL_REGULAR_ = 0x11;
+            static constexpr std::uint32_t S_THREAD_LOCAL_VARIABLES_ = 0x13;
+            static constexpr std::uint32_t S_ATTR_PURE_INSTRUCTIONS_ = 0x80000000;
+            static constexpr std::uint32_t S_ATTR_SOME_INSTRUCTIONS_ = 0x00000400;
+
+            // section indexes start from 1
+            if (!section_flags || n_sect > section_flags->size()) {
+                return boost::dll::symbol_type::unknown;
+            }
 
-        void operator()(std::ifstream& fs) const {
+            const std::uint32_t flags = (*section_flags)[n_sect - 1];
+            const std::uint32_t type = (flags & SECTION_TYPE_);
+            if (type >= S_THREAD_LOCAL_REGULAR_ && type <= S_THREAD_LOCAL_VARIABLES_) {
+                return boost::dll::symbol_type::tls;
+            }
+            if (flags & (S_ATTR_PURE_INSTRUCTIONS_ | S_ATTR_SOME_INSTRUCTIONS_)) {
+                return boost::dll::symbol_type::function;
+            }
+            return boost::dll::symbol_type::object;
+        }
+
+        bool operator()(binary_source& fs, std::uint64_t pos) const {
             symbol_header_t symbh;
-            read_raw(fs, symbh);
-            ret.reserve(ret.size() + symbh.nsyms);
+            fs.read(pos, symbh);
 
             nlist_t symbol;
-            std::string symbol_name;
+            std::string symbol_name_buffer;
             for (std::size_t j = 0; j < symbh.nsyms; ++j) {
-                fs.seekg(symbh.symoff + j * sizeof(nlist_t));
-                read_raw(fs, symbol);
+                fs.read(symbh.symoff + j * sizeof(nlist_t), symbol);
                 if (!symbol.n_strx) {
                     continue; // Symbol has no name
                 }
@@ -250,64 +303,170 @@ private:
                     continue; // Not in the required section
                 }
 
-                fs.seekg(symbh.stroff + symbol.n_strx);
-                std::getline(fs, symbol_name, '\0');
+                boost::core::string_view symbol_name = fs.c_str(
+                    static_cast<std::uint64_t>(symbh.stroff) + symbol.n_strx, symbol_name_buffer
+                );
                 if (symbol_name.empty()) {
                     continue;
                 }
 
                 if (symbol_name[0] == '_') {
                     // Linker adds additional '_' symbol. Could not find official docs for that case.
-                    ret.push_back(symbol_name.c_str() + 1);
-                } else {
-                    ret.push_back(symbol_name);
+                    symbol_name.remove_prefix(1);
+                }
+
+                static constexpr std::uint16_t N_WEAK_DEF_ = 0x0080;
+                boost::dll::symbol_info info;
+                info.name = symbol_name;
+                info.address = symbol.n_value;
+                info.size = 0;
+                info.type = type_of(symbol.n_sect);
+                info.binding = (symbol.n_desc & N_WEAK_DEF_) ? boost::dll::symbol_binding::weak : boost::dll::symbol_binding::global;
+                if (!f(info)) {
+                    return false;
                 }
             }
+
+            return true;
         }
     };
 
 public:
-    static std::vector<std::string> sections(std::ifstream& fs) {
-        std::vector<std::string> ret;
-        section_names_gather f = { ret };
-        command_finder(fs, SEGMENT_CMD_NUMBER, f);
-        return ret;
+    // Calls `bool f(boost::core::string_view name)` for each section name while `f` returns true.
+    // Returns false if the iteration was stopped by `f`.
+    template <class F>
+    static bool for_each_section(binary_source& fs, F f) {
+        section_names_gather<F> gather = { f };
+        return command_finder(fs, SEGMENT_CMD_NUMBER, gather);
     }
 
-private:
-    static header_t header(std::ifstream& fs) {
-        header_t h;
+    // Calls `bool f(const boost::dll::symbol_info& info)` for each symbol while `f` returns true.
+    // Returns false if the iteration was stopped by `f`.
+    template <class F>
+    static bool for_each_symbol_info(binary_source& fs, F f) {
+        std::vector<std::uint32_t> section_flags;
+        command_finder(fs, SEGMENT_CMD_NUMBER, [&section_flags](binary_source& src, std::uint64_t pos) {
+            segment_t segment;
+            src.read(pos, segment);
+            pos += sizeof(segment);
 
-        fs.seekg(0);
-        read_raw(fs, h);
+            section_t section;
+            for (std::size_t j = 0; j < segment.nsects; ++j) {
+                src.read(pos + j * sizeof(section), section);
+                section_flags.push_back(section.flags);
+            }
+            return true;
+        });
 
-        return h;
+        symbols_gather<F> gather = { f, 0, &section_flags };
+        return command_finder(fs, load_command_types::LC_SYMTAB_, gather);
     }
 
-public:
-    static std::vector<std::string> symbols(std::ifstream& fs) {
+    // Calls `bool f(boost::core::string_view name)` for each symbol while `f` returns true.
+    // Returns false if the iteration was stopped by `f`.
+    template <class F>
+    static bool for_each_symbol(binary_source& fs, F f) {
+        const auto names = [&f](const boost::dll::symbol_info& info) { return f(info.name); };
+        symbols_gather<const decltype(names)> gather = { names, 0, nullptr };
+        return command_finder(fs, load_command_types::LC_SYMTAB_, gather);
+    }
+
+    // Calls `bool f(boost::core::string_view name)` for each symbol from the section `section_name` while `f` returns true.
+    // Returns false if the iteration was stopped by `f`.
+    template <class F>
+    static bool for_each_symbol(binary_source& fs, const char* section_name, F f) {
+        // section indexes start from 1
+        std::size_t section_index = 0;
+        std::size_t i = 0;
+        for_each_section(fs, [&](boost::core::string_view name) {
+            ++i;
+            if (name == section_name) {
+                section_index = i;
+                return false;
+            }
+            return true;
+        });
+
+        if (!section_index) {
+            // No section with such name
+            return true;
+        }
+
+        const auto names = [&f](const boost::dll::symbol_info& info) { return f(info.name); };
+        symbols_gather<const decltype(names)> gather = { names, section_index, nullptr };
+        return command_finder(fs, load_command_types::LC_SYMTAB_, gather);
+    }
+
+    static std::vector<std::string> sections(binary_source& fs) {
         std::vector<std::string> ret;
-        symbol_names_gather f = { ret, 0 };
-        command_finder(fs, load_command_types::LC_SYMTAB_, f);
+        for_each_section(fs, [&ret](boost::core::string_view name) {
+            ret.emplace_back(name.data(), name.size());
+            return true;
+        });
         return ret;
     }
 
-    static std::vector<std::string> symbols(std::ifstream& fs, const char* section_name) {
-        // Not very optimal solution
-        std::vector<std::string> ret = sections(fs);
-        std::vector<std::string>::iterator it = std::find(ret.begin(), ret.end(), section_name);
-        if (it == ret.end()) {
-            // No section with such name
-            ret.clear();
-            return ret;
+    static std::vector<std::string> symbols(binary_source& fs) {
+        std::vector<std::string> ret;
+        for_each_symbol(fs, [&ret](boost::core::string_view name) {
+            ret.emplace_back(name.data(), name.size());
+            return true;
+        });
+        return ret;
+    }
+
+    static std::vector<std::string> symbols(binary_source& fs, const char* section_name) {
+        std::vector<std::string> ret;
+        for_each_symbol(fs, section_name, [&ret](boost::core::string_view name) {
+            ret.emplace_back(name.data(), name.size());
+            return true;
+        });
+        return ret;
+    }
+
+    // Calls `bool f(boost::core::string_view name)` for each library from the LC_LOAD_DYLIB_, LC_LOAD_WEAK_DYLIB_ and
+    // LC_REEXPORT_DYLIB_ commands while `f` returns true. Returns false if the iteration was stopped by `f`.
+    template <class F>
+    static bool for_each_dependency(binary_source& fs, F f) {
+        std::string name_buffer;
+        for (const command_position& command : cache(fs).commands) {
+            if (command.cmd != load_command_types::LC_LOAD_DYLIB_
+                && command.cmd != load_command_types::LC_LOAD_WEAK_DYLIB_
+                && command.cmd != load_command_types::LC_REEXPORT_DYLIB_)
+            {
+                continue;
+            }
+
+            dylib_command_ dylib;
+            fs.read(command.pos, dylib);
+            if (dylib.name_offset < sizeof(dylib) || dylib.name_offset >= dylib.cmdsize) {
+                continue;
+            }
+
+            const boost::core::string_view name = fs.c_str(command.pos + dylib.name_offset, name_buffer);
+            if (!name.empty() && !f(name)) {
+                return false;
+            }
         }
 
-        // section indexes start from 1
-        symbol_names_gather f = { ret, static_cast<std::size_t>(1 + (it - ret.begin())) };
-        ret.clear();
-        command_finder(fs, load_command_types::LC_SYMTAB_, f);
+        return true;
+    }
+
+    static std::vector<std::string> dependencies(binary_source& fs) {
+        std::vector<std::string> ret;
+        for_each_dependency(fs, [&ret](boost::core::string_view name) {
+            ret.emplace_back(name.data(), name.size());
+            return true;
+        });
         return ret;
     }
+
+    // Returns true if the symbol `name` exists
+    static bool has_symbol(binary_source& fs, boost::core::string_view name) {
+        return !for_each_symbol(fs, [name](boost::core::string_view symbol) {
+            return symbol != name;
+        });
+    }
 };
 
 using macho_info32 = macho_info<std::uint32_t>;
@@ -14,12 +14,15 @@
 # pragma once
 #endif
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
-#include <fstream>
-#include <string> // for std::getline
+#include <string>
 #include <vector>
 
+#include <boost/dll/detail/binary_source.hpp>
+#include <boost/dll/symbol_info.hpp>
+
 namespace boost { namespace dll { namespace detail {
 
 // reference:
@@ -89,6 +92,14 @@ struct IMAGE_EXPORT_DIRECTORY_ { // 32/64 independent header
     boost::dll::detail::DWORD_  AddressOfNameOrdinals;
 };
 
+struct IMAGE_IMPORT_DESCRIPTOR_ { // 32/64 independent header
+    boost::dll::detail::DWORD_  OriginalFirstThunk;
+    boost::dll::detail::DWORD_  TimeDateStamp;
+    boost::dll::detail::DWORD_  ForwarderChain;
+    boost::dll::detail::DWORD_  Name;
+    boost::dll::detail::DWORD_  FirstThunk;
+};
+
 struct IMAGE_SECTION_HEADER_ { // 32/64 independent header
     static const std::size_t    IMAGE_SIZEOF_SHORT_NAME_ = 8;
 
@@ -169,16 +180,10 @@ class pe_info {
     using section_t = IMAGE_SECTION_HEADER_;
     using dos_t = IMAGE_DOS_HEADER_;
 
-    template <class T>
-    static void read_raw(std::ifstream& fs, T& value, std::size_t size = sizeof(T)) {
-        fs.read(reinterpret_cast<char*>(&value), size);
-    }
-
 public:
-    static bool parsing_supported(std::ifstream& fs) {
+    static bool parsing_supported(binary_source& fs) {
         dos_t dos;
-        fs.seekg(0);
-        fs.read(reinterpret_cast<char*>(&dos), sizeof(dos));
+        fs.read(0, dos);
 
         // 'MZ' and 'ZM' according to Wikipedia
         if (dos.e_magic != 0x4D5A && dos.e_magic != 0x5A4D) {
@@ -186,30 +191,36 @@ public:
         }
 
         header_t h;
-        fs.seekg(dos.e_lfanew);
-        fs.read(reinterpret_cast<char*>(&h), sizeof(h));
+        fs.read(dos.e_lfanew, h);
 
         return h.Signature == 0x00004550 // 'PE00'
                 && h.OptionalHeader.Magic == (sizeof(std::uint32_t) == sizeof(AddressOffsetT) ? 0x10B : 0x20B);
     }
 
 private:
-    static header_t header(std::ifstream& fs) {
-        header_t h;
-
-        dos_t dos;
-        fs.seekg(0);
-        read_raw(fs, dos);
-
-        fs.seekg(dos.e_lfanew);
-        read_raw(fs, h);
+    // NT headers and section table are parsed once per `binary_source`.
+    struct cache_t: binary_source::cache_base {
+        header_t                h;
+        std::vector<section_t>  sections;
+    };
+
+    static const cache_t& cache(binary_source& fs) {
+        return fs.cached<cache_t>([&fs](cache_t& c) {
+            dos_t dos;
+            fs.read(0, dos);
+            const std::uint64_t header_offset = static_cast<std::uint64_t>(dos.e_lfanew);
+            fs.read(header_offset, c.h);
 
-        return h;
+            c.sections.resize(c.h.FileHeader.NumberOfSections);
+            if (!c.sections.empty()) {
+                fs.read(header_offset + sizeof(header_t), c.sections[0], c.sections.size() * sizeof(section_t));
+            }
+        });
     }
 
-    static exports_t exports(std::ifstream& fs, const header_t& h) {
+    static exports_t exports(binary_source& fs) {
         static const unsigned int IMAGE_DIRECTORY_ENTRY_EXPORT_ = 0;
-        const std::size_t exp_virtual_address = h.OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT_].VirtualAddress;
+        const std::size_t exp_virtual_address = cache(fs).h.OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT_].VirtualAddress;
         exports_t exports;
 
         if (exp_virtual_address == 0) {
@@ -218,26 +229,14 @@ private:
             return exports;
         }
 
-        const std::size_t real_offset = get_file_offset(fs, exp_virtual_address, h);
-
-        fs.seekg(real_offset);
-        read_raw(fs, exports);
+        const std::size_t real_offset = get_file_offset(fs, exp_virtual_address);
+        fs.read(real_offset, exports);
 
         return exports;
     }
 
-    static std::size_t get_file_offset(std::ifstream& fs, std::size_t virtual_address, const header_t& h) {
-        section_t image_section_header;
-        
-        {   // fs.seekg to the beginning on section headers
-            dos_t dos;
-            fs.seekg(0);
-            read_raw(fs, dos);
-            fs.seekg(dos.e_lfanew + sizeof(header_t));
-        }
-
-        for (std::size_t i = 0;i < h.FileHeader.NumberOfSections;++i) {
-            read_raw(fs, image_section_header);
+    static std::size_t get_file_offset(binary_source& fs, std::size_t virtual_address) {
+        for (const section_t& image_section_header : cache(fs).sections) {
             if (virtual_address >= image_section_header.VirtualAddress 
                 && virtual_address < image_section_header.VirtualAddress + image_section_header.SizeOfRawData) 
             {
@@ -249,76 +248,133 @@ private:
     }
 
 public:
-    static std::vector<std::string> sections(std::ifstream& fs) {
-        std::vector<std::string> ret;
-
-        const header_t h = header(fs);
-        ret.reserve(h.FileHeader.NumberOfSections);
-
+    // Calls `bool f(boost::core::string_view name)` for each section name while `f` returns true.
+    // Returns false if the iteration was stopped by `f`.
+    template <class F>
+    static bool for_each_section(binary_source& fs, F f) {
         // get names, e.g: .text .rdata .data .rsrc .reloc
-        section_t image_section_header;
         char name_helper[section_t::IMAGE_SIZEOF_SHORT_NAME_ + 1];
         std::memset(name_helper, 0, sizeof(name_helper));
-        for (std::size_t i = 0;i < h.FileHeader.NumberOfSections;++i) {
+        for (const section_t& image_section_header : cache(fs).sections) {
             // There is no terminating null character if the string is exactly eight characters long
-            read_raw(fs, image_section_header);
             std::memcpy(name_helper, image_section_header.Name, section_t::IMAGE_SIZEOF_SHORT_NAME_);
             
             if (name_helper[0] != '/') {
-                ret.push_back(name_helper);
+                if (!f(boost::core::string_view(name_helper))) {
+                    return false;
+                }
             } else {
                 // For longer names, image_section_header.Name contains a slash (/) followed by ASCII representation of a decimal number.
                 // this number is an offset into the string table.
                 // TODO: fixme
-                ret.push_back(name_helper);
+                if (!f(boost::core::string_view(name_helper))) {
+                    return false;
+                }
             }
         }
 
-        return ret;
+        return true;
     }
 
-    static std::vector<std::string> symbols(std::ifstream& fs) {
-        std::vector<std::string> ret;
-
-        const header_t h = header(fs);
-        const exports_t exprt = exports(fs, h);
+    // Calls `bool f(boost::core::string_view name)` for each exported symbol while `f` returns true.
+    // Returns false if the iteration was stopped by `f`.
+    template <class F>
+    static bool for_each_symbol(binary_source& fs, F f) {
+        const exports_t exprt = exports(fs);
         const std::size_t exported_symbols = exprt.NumberOfNames;
 
         if (exported_symbols == 0) {
-            return ret;
+            return true;
         }
 
-        const std::size_t fixed_names_addr = get_file_offset(fs, exprt.AddressOfNames, h);
+        const std::size_t fixed_names_addr = get_file_offset(fs, exprt.AddressOfNames);
 
-        ret.reserve(exported_symbols);
         boost::dll::detail::DWORD_ name_offset;
         std::string symbol_name;
         for (std::size_t i = 0;i < exported_symbols;++i) {
-            fs.seekg(fixed_names_addr + i * sizeof(name_offset));
-            read_raw(fs, name_offset);
-            fs.seekg(get_file_offset(fs, name_offset, h));
-            std::getline(fs, symbol_name, '\0');
-            ret.push_back(symbol_name);
+            fs.read(fixed_names_addr + i * sizeof(name_offset), name_offset);
+            if (!f(fs.c_str(get_file_offset(fs, name_offset), symbol_name))) {
+                return false;
+            }
         }
 
-        return ret;
+        return true;
     }
 
-    static std::vector<std::string> symbols(std::ifstream& fs, const char* section_name) {
-        std::vector<std::string> ret;
+    // Calls `bool f(const boost::dll::symbol_info& info)` for each exported symbol while `f` returns true.
+    // Returns false if the iteration was stopped by `f`.
+    template <class F>
+    static bool for_each_symbol_info(binary_source& fs, F f) {
+        const exports_t exprt = exports(fs);
+        const std::size_t exported_symbols = exprt.NumberOfNames;
 
-        const header_t h = header(fs);
-        
+        if (exported_symbols == 0) {
+            return true;
+        }
+
+        static const unsigned int IMAGE_DIRECTORY_ENTRY_EXPORT_ = 0;
+        static const boost::dll::detail::DWORD_ IMAGE_SCN_CNT_CODE_ = 0x00000020;
+        static const boost::dll::detail::DWORD_ IMAGE_SCN_MEM_EXECUTE_ = 0x20000000;
+        const IMAGE_DATA_DIRECTORY_ exports_dir = cache(fs).h.OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT_];
+
+        const std::size_t fixed_names_addr = get_file_offset(fs, exprt.AddressOfNames);
+        const std::size_t fixed_ordinals_addr = get_file_offset(fs, exprt.AddressOfNameOrdinals);
+        const std::size_t fixed_functions_addr = get_file_offset(fs, exprt.AddressOfFunctions);
+
+        boost::dll::detail::DWORD_ name_offset;
+        boost::dll::detail::WORD_ ordinal;
+        boost::dll::detail::DWORD_ rva;
+        std::string symbol_name;
+        boost::dll::symbol_info info;
+        info.size = 0;
+        info.binding = boost::dll::symbol_binding::global;
+        for (std::size_t i = 0;i < exported_symbols;++i) {
+            fs.read(fixed_names_addr + i * sizeof(name_offset), name_offset);
+            fs.read(fixed_ordinals_addr + i * sizeof(ordinal), ordinal);
+
+            rva = 0;
+            if (ordinal < exprt.NumberOfFunctions) {  // required for clang-win created PE
+                fs.read(fixed_functions_addr + ordinal * sizeof(rva), rva);
+            }
+
+            info.address = rva;
+            info.type = boost::dll::symbol_type::unknown;
+            // Forwarders point to a string inside the exports directory
+            const bool is_forwarder = (rva >= exports_dir.VirtualAddress && rva < exports_dir.VirtualAddress + exports_dir.Size);
+            if (rva && !is_forwarder) {
+                for (const section_t& image_section_header : cache(fs).sections) {
+                    if (rva >= image_section_header.VirtualAddress
+                        && rva < image_section_header.VirtualAddress + (std::max)(image_section_header.Misc.VirtualSize, image_section_header.SizeOfRawData))
+                    {
+                        info.type = (image_section_header.Characteristics & (IMAGE_SCN_CNT_CODE_ | IMAGE_SCN_MEM_EXECUTE_))
+                            ? boost::dll::symbol_type::function
+                            : boost::dll::symbol_type::object;
+                        break;
+                    }
+                }
+            }
+
+            info.name = fs.c_str(get_file_offset(fs, name_offset), symbol_name);
+            if (!f(info)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Calls `bool f(boost::core::string_view name)` for each exported symbol from the section `section_name` while `f` returns true.
+    // Returns false if the iteration was stopped by `f`.
+    template <class F>
+    static bool for_each_symbol(binary_source& fs, const char* section_name, F f) {
         std::size_t section_begin_addr = 0;
         std::size_t section_end_addr = 0;
         
         {   // getting address range for the section
-            section_t image_section_header;
             char name_helper[section_t::IMAGE_SIZEOF_SHORT_NAME_ + 1];
             std::memset(name_helper, 0, sizeof(name_helper));
-            for (std::size_t i = 0;i < h.FileHeader.NumberOfSections;++i) {
+            for (const section_t& image_section_header : cache(fs).sections) {
                 // There is no terminating null character if the string is exactly eight characters long
-                read_raw(fs, image_section_header);
                 std::memcpy(name_helper, image_section_header.Name, section_t::IMAGE_SIZEOF_SHORT_NAME_);
                 if (!std::strcmp(section_name, name_helper)) {
                     section_begin_addr = image_section_header.PointerToRawData;
@@ -328,102 +384,146 @@ public:
             
             // returning empty result if section was not found
             if(section_begin_addr == 0 || section_end_addr == 0)
-                return ret;
+                return true;
         }
 
-        const exports_t exprt = exports(fs, h);
+        const exports_t exprt = exports(fs);
         const std::size_t exported_symbols = exprt.NumberOfFunctions;
-        const std::size_t fixed_names_addr = get_file_offset(fs, exprt.AddressOfNames, h);
-        const std::size_t fixed_ordinals_addr = get_file_offset(fs, exprt.AddressOfNameOrdinals, h);
-        const std::size_t fixed_functions_addr = get_file_offset(fs, exprt.AddressOfFunctions, h);
+        const std::size_t fixed_names_addr = get_file_offset(fs, exprt.AddressOfNames);
+        const std::size_t fixed_ordinals_addr = get_file_offset(fs, exprt.AddressOfNameOrdinals);
+        const std::size_t fixed_functions_addr = get_file_offset(fs, exprt.AddressOfFunctions);
 
-        ret.reserve(exported_symbols);
         boost::dll::detail::DWORD_ ptr;
         boost::dll::detail::WORD_ ordinal;
         std::string symbol_name;
         for (std::size_t i = 0;i < exported_symbols;++i) {
             // getting ordinal
-            fs.seekg(fixed_ordinals_addr + i * sizeof(ordinal));
-            read_raw(fs, ordinal);
+            fs.read(fixed_ordinals_addr + i * sizeof(ordinal), ordinal);
             if (ordinal >= exported_symbols) {  // required for clang-win created PE
                 continue;
             }
 
             // getting function addr
-            fs.seekg(fixed_functions_addr + ordinal * sizeof(ptr));
-            read_raw(fs, ptr);
-            ptr = static_cast<boost::dll::detail::DWORD_>( get_file_offset(fs, ptr, h) );
+            fs.read(fixed_functions_addr + ordinal * sizeof(ptr), ptr);
+            ptr = static_cast<boost::dll::detail::DWORD_>( get_file_offset(fs, ptr) );
 
             if (ptr >= section_end_addr || ptr < section_begin_addr) {
                 continue;
             }
 
-            fs.seekg(fixed_names_addr + i * sizeof(ptr));
-            read_raw(fs, ptr);
-            fs.seekg(get_file_offset(fs, ptr, h));
-            std::getline(fs, symbol_name, '\0');
-            ret.push_back(symbol_name);
+            fs.read(fixed_names_addr + i * sizeof(ptr), ptr);
+            if (!f(fs.c_str(get_file_offset(fs, ptr), symbol_name))) {
+                return false;
+            }
         }
 
+        return true;
+    }
+
+    static std::vector<std::string> sections(binary_source& fs) {
+        std::vector<std::string> ret;
+        ret.reserve(cache(fs).sections.size());
+        for_each_section(fs, [&ret](boost::core::string_view name) {
+            ret.emplace_back(name.data(), name.size());
+            return true;
+        });
         return ret;
     }
-    
-    // a test method to get dependents modules,
-    // who my plugin imports (1st level only)
-    /*
-    e.g. for myself I get:
-      KERNEL32.dll
-      MSVCP110D.dll
-      boost_system-vc-mt-gd-1_56.dll
-      MSVCR110D.dll
-    */
-    /*
-    static std::vector<std::string> depend_of(boost::dll::fs::error_code &ec) noexcept {
+
+    static std::vector<std::string> symbols(binary_source& fs) {
         std::vector<std::string> ret;
+        for_each_symbol(fs, [&ret](boost::core::string_view name) {
+            ret.emplace_back(name.data(), name.size());
+            return true;
+        });
+        return ret;
+    }
 
-        IMAGE_DOS_HEADER* image_dos_header = (IMAGE_DOS_HEADER*)native();
-        if(!image_dos_header) {
-            // ERROR_BAD_EXE_FORMAT 
-            ec = boost::dll::fs::make_error_code(
-                 boost::dll::fs::errc::executable_format_error
-                 );
+    static std::vector<std::string> symbols(binary_source& fs, const char* section_name) {
+        std::vector<std::string> ret;
+        for_each_symbol(fs, section_name, [&ret](boost::core::string_view name) {
+            ret.emplace_back(name.data(), name.size());
+            return true;
+        });
+        return ret;
+    }
 
-            return ret;
+    // Returns true if the symbol `name` is exported. Export names are lexically ordered
+    // (the Windows loader relies on that), so the binary search is used.
+    static bool has_symbol(binary_source& fs, boost::core::string_view name) {
+        const exports_t exprt = exports(fs);
+        if (exprt.NumberOfNames == 0) {
+            return false;
         }
 
-        IMAGE_OPTIONAL_HEADER* image_optional_header = (IMAGE_OPTIONAL_HEADER*)((boost::dll::detail::BYTE_*)native() + image_dos_header->e_lfanew + 24);
-        if(!image_optional_header) {
-            // ERROR_BAD_EXE_FORMAT 
-            ec = boost::dll::fs::make_error_code(
-                 boost::dll::fs::errc::executable_format_error
-                 );
+        const std::size_t fixed_names_addr = get_file_offset(fs, exprt.AddressOfNames);
 
-            return ret;
+        boost::dll::detail::DWORD_ name_offset;
+        std::string symbol_name;
+        std::size_t first = 0;
+        std::size_t last = exprt.NumberOfNames;
+        while (first < last) {
+            const std::size_t middle = first + (last - first) / 2;
+            fs.read(fixed_names_addr + middle * sizeof(name_offset), name_offset);
+
+            const int cmp = fs.c_str(get_file_offset(fs, name_offset), symbol_name).compare(name);
+            if (cmp == 0) {
+                return true;
+            } else if (cmp < 0) {
+                first = middle + 1;
+            } else {
+                last = middle;
+            }
         }
 
-        IMAGE_IMPORT_DESCRIPTOR* image_import_descriptor =  (IMAGE_IMPORT_DESCRIPTOR*)((boost::dll::detail::BYTE_*)native() + image_optional_header->DataDirectory[IMAGE_DIRECTORY_ENTRY_IMPORT].VirtualAddress);
-        if(!image_import_descriptor) {
-            // ERROR_BAD_EXE_FORMAT 
-            ec = boost::dll::fs::make_error_code(
-                 boost::dll::fs::errc::executable_format_error
-                 );
+        return false;
+    }
+    
+    // Calls `bool f(boost::core::string_view name)` for each module from the import directory while `f` returns true
+    // (first level dependencies only). Returns false if the iteration was stopped by `f`.
+    template <class F>
+    static bool for_each_dependency(binary_source& fs, F f) {
+        static const unsigned int IMAGE_DIRECTORY_ENTRY_IMPORT_ = 1;
+        const IMAGE_DATA_DIRECTORY_ imports_dir = cache(fs).h.OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_IMPORT_];
+        if (!imports_dir.VirtualAddress) {
+            return true;
+        }
 
-            return ret;
+        const std::size_t imports_offset = get_file_offset(fs, imports_dir.VirtualAddress);
+        if (!imports_offset) {
+            return true;
         }
 
-        while(image_import_descriptor->FirstThunk) {
-           std::string module_name = reinterpret_cast<char*>((boost::dll::detail::BYTE_*)native() + image_import_descriptor->Name);
+        IMAGE_IMPORT_DESCRIPTOR_ descriptor;
+        std::string module_name;
+        for (std::size_t i = 0; ; ++i) {
+            fs.read(imports_offset + i * sizeof(descriptor), descriptor);
+            if (!descriptor.Name && !descriptor.FirstThunk) {
+                break; // Import directory ends with a zeroed descriptor
+            }
+
+            const std::size_t name_offset = get_file_offset(fs, descriptor.Name);
+            if (!name_offset) {
+                continue;
+            }
 
-           if(module_name.size()) {
-              ret.push_back(module_name);
-           }
-                
-           image_import_descriptor++;
+            const boost::core::string_view name = fs.c_str(name_offset, module_name);
+            if (!name.empty() && !f(name)) {
+                return false;
+            }
         }
 
+        return true;
+    }
+
+    static std::vector<std::string> dependencies(binary_source& fs) {
+        std::vector<std::string> ret;
+        for_each_dependency(fs, [&ret](boost::core::string_view name) {
+            ret.emplace_back(name.data(), name.size());
+            return true;
+        });
         return ret;
     }
-*/
 };
 
 using pe_info32 = pe_info<boost::dll::detail::DWORD_>;
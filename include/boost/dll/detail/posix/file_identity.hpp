@@ -0,0 +1,57 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_POSIX_FILE_IDENTITY_HPP
+#define BOOST_DLL_DETAIL_POSIX_FILE_IDENTITY_HPP
+
+#include <boost/dll/config.hpp>
+#include <boost/predef/os.h>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cerrno>
+#include <cstdint>
+#include <system_error>
+
+#include <sys/stat.h>
+
+namespace boost { namespace dll { namespace detail {
+
+// Values that change if the file is replaced or modified.
+struct file_identity {
+    std::uint64_t   inode;
+    std::uint64_t   size;
+    std::int64_t    mtime_ns;
+
+    bool operator==(const file_identity& other) const noexcept {
+        return inode == other.inode && size == other.size && mtime_ns == other.mtime_ns;
+    }
+};
+
+inline file_identity get_file_identity(const boost::dll::fs::path& p, std::error_code& ec) noexcept {
+    file_identity ret{0, 0, 0};
+
+    struct stat st;
+    if (::stat(p.c_str(), &st) != 0) {
+        ec = std::error_code(errno, std::generic_category());
+        return ret;
+    }
+
+    ret.inode = static_cast<std::uint64_t>(st.st_ino);
+    ret.size = static_cast<std::uint64_t>(st.st_size);
+#if BOOST_OS_MACOS || BOOST_OS_IOS
+    ret.mtime_ns = static_cast<std::int64_t>(st.st_mtimespec.tv_sec) * 1000000000 + st.st_mtimespec.tv_nsec;
+#else
+    ret.mtime_ns = static_cast<std::int64_t>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+#endif
+    return ret;
+}
+
+}}} // namespace boost::dll::detail
+
+#endif // BOOST_DLL_DETAIL_POSIX_FILE_IDENTITY_HPP
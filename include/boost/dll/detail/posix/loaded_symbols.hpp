@@ -0,0 +1,176 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_POSIX_LOADED_SYMBOLS_HPP
+#define BOOST_DLL_DETAIL_POSIX_LOADED_SYMBOLS_HPP
+
+#include <boost/dll/config.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/predef/os.h>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstddef>
+#include <cstdint>
+
+#if !BOOST_OS_MACOS && !BOOST_OS_IOS && !BOOST_OS_ANDROID && !BOOST_OS_QNX && !BOOST_OS_CYGWIN
+#   include <dlfcn.h>
+#   include <link.h>    // struct link_map, ElfW
+#   define BOOST_DLL_DETAIL_LOADED_SYMBOLS_FROM_LINK_MAP
+#endif
+
+namespace boost { namespace dll { namespace detail {
+
+#ifdef BOOST_DLL_DETAIL_LOADED_SYMBOLS_FROM_LINK_MAP
+
+// Dynamic symbols table of a module that is already mapped by the dynamic loader.
+// Reads the ".dynsym" and ".dynstr" tables through the `PT_DYNAMIC` segment (`link_map::l_ld`)
+// without touching the file.
+class loaded_symbols {
+    const ElfW(Sym)*    symbols_ = nullptr;
+    const char*         strings_ = nullptr;
+    std::size_t         strings_size_ = 0;
+    std::size_t         symbols_count_ = 0;
+
+    // Some loaders (glibc on most platforms) relocate the pointers in the dynamic section, others do not.
+    static std::uintptr_t to_address(const struct link_map* lm, std::uintptr_t ptr) noexcept {
+        const std::uintptr_t base = static_cast<std::uintptr_t>(lm->l_addr);
+        return ptr < base ? ptr + base : ptr;
+    }
+
+    // The ".gnu.hash" section does not store the symbols count, so it must be computed
+    // from the last chain of the biggest bucket.
+    static std::size_t gnu_hash_symbols_count(const std::uint32_t* hash) noexcept {
+        const std::uint32_t nbuckets = hash[0];
+        const std::uint32_t symoffset = hash[1];
+        const std::uint32_t bloom_size = hash[2];
+
+        const std::uint32_t* const buckets = reinterpret_cast<const std::uint32_t*>(
+            reinterpret_cast<const ElfW(Addr)*>(hash + 4) + bloom_size
+        );
+        const std::uint32_t* const chain = buckets + nbuckets;
+
+        std::uint32_t last = 0;
+        for (std::uint32_t i = 0; i < nbuckets; ++i) {
+            if (buckets[i] > last) {
+                last = buckets[i];
+            }
+        }
+
+        if (last < symoffset) {
+            return symoffset;
+        }
+
+        while (!(chain[last - symoffset] & 1)) {
+            ++last;
+        }
+
+        return static_cast<std::size_t>(last) + 1;
+    }
+
+    static bool is_exported(const ElfW(Sym)& sym) noexcept {
+        const unsigned char visibility = (sym.st_other & 0x03);
+        return (visibility == STV_DEFAULT || visibility == STV_PROTECTED)
+                && (sym.st_info >> 4) != STB_LOCAL && sym.st_shndx != SHN_UNDEF && !!sym.st_size;
+    }
+
+public:
+    // Returns false if the symbols could not be located in memory.
+    bool init(void* handle) noexcept {
+        const struct link_map* lm = nullptr;
+#if BOOST_OS_BSD_FREE
+        if (dlinfo(handle, RTLD_DI_LINKMAP, &lm) < 0) {
+            return false;
+        }
+#else
+        // `handle` is a `struct link_map*`, see path_from_handle.hpp for details
+        lm = static_cast<const struct link_map*>(handle);
+#endif
+        if (!lm || !lm->l_ld) {
+            return false;
+        }
+
+        const std::uint32_t* sysv_hash = nullptr;
+        const std::uint32_t* gnu_hash = nullptr;
+        for (const ElfW(Dyn)* dyn = lm->l_ld; dyn->d_tag != DT_NULL; ++dyn) {
+            switch (dyn->d_tag) {
+            case DT_SYMTAB:
+                symbols_ = reinterpret_cast<const ElfW(Sym)*>(to_address(lm, dyn->d_un.d_ptr));
+                break;
+            case DT_STRTAB:
+                strings_ = reinterpret_cast<const char*>(to_address(lm, dyn->d_un.d_ptr));
+                break;
+            case DT_STRSZ:
+                strings_size_ = static_cast<std::size_t>(dyn->d_un.d_val);
+                break;
+            case DT_HASH:
+                sysv_hash = reinterpret_cast<const std::uint32_t*>(to_address(lm, dyn->d_un.d_ptr));
+                break;
+            case DT_GNU_HASH:
+                gnu_hash = reinterpret_cast<const std::uint32_t*>(to_address(lm, dyn->d_un.d_ptr));
+                break;
+            }
+        }
+
+        if (!symbols_ || !strings_ || !strings_size_) {
+            return false;
+        }
+
+        if (sysv_hash) {
+            symbols_count_ = sysv_hash[1]; // nchain
+        } else if (gnu_hash) {
+            symbols_count_ = gnu_hash_symbols_count(gnu_hash);
+        } else {
+            return false;
+        }
+
+        return true;
+    }
+
+    // Calls `bool f(boost::core::string_view name)` for each exported symbol while `f` returns true.
+    // Returns false if the iteration was stopped by `f`.
+    template <class F>
+    bool for_each_symbol(F f) const {
+        for (std::size_t i = 0; i < symbols_count_; ++i) {
+            const ElfW(Sym)& sym = symbols_[i];
+            if (!is_exported(sym) || sym.st_name >= strings_size_) {
+                continue;
+            }
+
+            const boost::core::string_view name(strings_ + sym.st_name);
+            if (!name.empty() && !f(name)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+#undef BOOST_DLL_DETAIL_LOADED_SYMBOLS_FROM_LINK_MAP
+
+#else // #ifdef BOOST_DLL_DETAIL_LOADED_SYMBOLS_FROM_LINK_MAP
+
+// The symbols of loaded modules are not available on this platform, the file must be used.
+class loaded_symbols {
+public:
+    bool init(void* /*handle*/) noexcept {
+        return false;
+    }
+
+    template <class F>
+    bool for_each_symbol(F /*f*/) const {
+        return true;
+    }
+};
+
+#endif // #ifdef BOOST_DLL_DETAIL_LOADED_SYMBOLS_FROM_LINK_MAP
+
+}}} // namespace boost::dll::detail
+
+#endif // BOOST_DLL_DETAIL_POSIX_LOADED_SYMBOLS_HPP
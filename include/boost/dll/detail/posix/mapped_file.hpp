@@ -0,0 +1,108 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_POSIX_MAPPED_FILE_HPP
+#define BOOST_DLL_DETAIL_POSIX_MAPPED_FILE_HPP
+
+#include <boost/dll/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cerrno>
+#include <cstddef>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace boost { namespace dll { namespace detail {
+
+// Read-only mapping of a whole file into memory.
+class mapped_file {
+    const char*     data_;
+    std::size_t     size_;
+
+public:
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    mapped_file() noexcept
+        : data_(nullptr)
+        , size_(0)
+    {}
+
+    ~mapped_file() noexcept {
+        close();
+    }
+
+    bool open(const boost::dll::fs::path& p, std::error_code& ec) noexcept {
+        close();
+
+        const int fd = ::open(p.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            ec = std::error_code(errno, std::generic_category());
+            return false;
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ec = std::error_code(errno, std::generic_category());
+            ::close(fd);
+            return false;
+        }
+
+        // Empty files and special files (pipes, devices) could not be mapped
+        if (!S_ISREG(st.st_mode) || st.st_size <= 0) {
+            ec = std::make_error_code(std::errc::invalid_argument);
+            ::close(fd);
+            return false;
+        }
+
+        const std::size_t size = static_cast<std::size_t>(st.st_size);
+        void* const p_data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        const int mmap_errno = errno;
+
+        // Mapping stays valid after the descriptor is closed
+        ::close(fd);
+
+        if (p_data == MAP_FAILED) {
+            ec = std::error_code(mmap_errno, std::generic_category());
+            return false;
+        }
+
+        data_ = static_cast<const char*>(p_data);
+        size_ = size;
+        return true;
+    }
+
+    void close() noexcept {
+        if (data_) {
+            ::munmap(const_cast<char*>(data_), size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    bool is_open() const noexcept {
+        return !!data_;
+    }
+
+    const char* data() const noexcept {
+        return data_;
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+};
+
+}}} // namespace boost::dll::detail
+
+#endif // BOOST_DLL_DETAIL_POSIX_MAPPED_FILE_HPP
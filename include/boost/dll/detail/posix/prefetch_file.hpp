@@ -0,0 +1,60 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_POSIX_PREFETCH_FILE_HPP
+#define BOOST_DLL_DETAIL_POSIX_PREFETCH_FILE_HPP
+
+#include <boost/dll/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cerrno>
+#include <system_error>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace boost { namespace dll { namespace detail {
+
+// Asks the OS to read the whole file into the page cache, so that the following loading of the file
+// does not wait for the disk.
+inline void prefetch_file(const boost::dll::fs::path& p, std::error_code& ec) noexcept {
+    const int fd = ::open(p.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        ec = std::error_code(errno, std::generic_category());
+        return;
+    }
+
+#if defined(POSIX_FADV_WILLNEED)
+    // Starts the asynchronous read ahead of the whole file
+    const int res = ::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+    if (res != 0) {
+        ec = std::error_code(res, std::generic_category());
+    }
+#else
+    char buffer[64 * 1024];
+    for (;;) {
+        const ::ssize_t res = ::read(fd, buffer, sizeof(buffer));
+        if (res < 0 && errno == EINTR) {
+            continue;
+        }
+        if (res < 0) {
+            ec = std::error_code(errno, std::generic_category());
+        }
+        if (res <= 0) {
+            break;
+        }
+    }
+#endif
+
+    ::close(fd);
+}
+
+}}} // namespace boost::dll::detail
+
+#endif // BOOST_DLL_DETAIL_POSIX_PREFETCH_FILE_HPP
@@ -10,6 +10,8 @@
 
 #include <boost/dll/config.hpp>
 #include <boost/dll/shared_library_load_mode.hpp>
+#include <boost/dll/load_observer.hpp>
+#include <boost/dll/detail/library_control_block.hpp>
 #include <boost/dll/detail/posix/path_from_handle.hpp>
 #include <boost/dll/detail/posix/program_location_impl.hpp>
 
@@ -39,6 +41,7 @@ public:
 
     shared_library_impl() noexcept
         : handle_(nullptr)
+        , control_(nullptr)
     {}
 
     ~shared_library_impl() noexcept {
@@ -47,12 +50,15 @@ public:
 
     shared_library_impl(shared_library_impl&& sl) noexcept
         : handle_(sl.handle_)
+        , control_(sl.control_)
     {
         sl.handle_ = nullptr;
+        sl.control_ = nullptr;
     }
 
     explicit shared_library_impl(native_handle_t handle) noexcept
         : handle_(handle)
+        , control_(handle ? boost::dll::detail::library_control_block::create(!is_global_scope(handle)) : nullptr)
     {}
 
     shared_library_impl & operator=(shared_library_impl&& sl) noexcept {
@@ -72,6 +78,105 @@ public:
     }
 
     void load(boost::dll::fs::path sl, load_mode::type portable_mode, std::error_code &ec) {
+        const bool global_scope = load_handle(std::move(sl), portable_mode, ec);
+        if (handle_) {
+            control_ = boost::dll::detail::library_control_block::create(!global_scope);
+        }
+    }
+
+    bool is_loaded() const noexcept {
+        return (handle_ != 0);
+    }
+
+    void unload() noexcept {
+        if (!is_loaded()) {
+            return;
+        }
+
+        if (!control_ || control_->release()) {
+            boost::dll::detail::load_event_timer timer;
+            dlclose(handle_);
+            timer.report(load_phase::unload, nullptr, handle_, nullptr, true);
+        }
+        handle_ = 0;
+        control_ = nullptr;
+    }
+
+    // Makes *this reference the same native handle as `sl` by incrementing the reference count.
+    // Returns false if `sl` has no control block and the library must be loaded by path.
+    bool share(const shared_library_impl& sl) noexcept {
+        if (!sl.control_) {
+            return false;
+        }
+
+        sl.control_->add_ref();
+        unload();
+        handle_ = sl.handle_;
+        control_ = sl.control_;
+        return true;
+    }
+
+    // Returns the number of shared_library instances that reference the native handle through the control block.
+    std::size_t use_count() const noexcept {
+        return control_ ? control_->use_count() : static_cast<std::size_t>(is_loaded());
+    }
+
+    void swap(shared_library_impl& rhs) noexcept {
+        boost::core::invoke_swap(handle_, rhs.handle_);
+        boost::core::invoke_swap(control_, rhs.control_);
+    }
+
+    boost::dll::fs::path full_module_path(std::error_code &ec) const {
+        return boost::dll::detail::path_from_handle(handle_, ec);
+    }
+
+    static boost::dll::fs::path suffix() {
+        // https://sourceforge.net/p/predef/wiki/OperatingSystems/
+#if BOOST_OS_MACOS || BOOST_OS_IOS
+        return ".dylib";
+#else
+        return ".so";
+#endif
+    }
+
+    void* symbol_addr(const char* sb, std::error_code &ec) const noexcept {
+        // dlsym - obtain the address of a symbol from a dlopen object
+        boost::dll::detail::load_event_timer timer;
+        void* const symbol = dlsym(handle_, sb);
+        timer.report(load_phase::symbol_lookup, nullptr, handle_, sb, !!symbol);
+        if (symbol == nullptr) {
+            ec = std::make_error_code(
+                std::errc::invalid_seek
+            );
+        }
+
+        // If handle does not refer to a valid object opened by dlopen(),
+        // or if the named symbol cannot be found within any of the objects
+        // associated with handle, dlsym() shall return NULL.
+        // More detailed diagnostic information shall be available through dlerror().
+
+        return symbol;
+    }
+
+    // Same as symbol_addr(), but looks up the address in the cache of the control block first.
+    void* cached_symbol_addr(const char* sb, std::error_code &ec) const noexcept {
+        if (!control_ || !control_->caches_symbols()) {
+            return symbol_addr(sb, ec);
+        }
+
+        return control_->symbols().find_or_insert(sb, [this, sb, &ec]() noexcept {
+            return symbol_addr(sb, ec);
+        });
+    }
+
+    native_handle_t native() const noexcept {
+        return handle_;
+    }
+
+private:
+    // Loads the native handle without creating the control block. Internal step of load().
+    // Returns true if the handle is the one of the program itself, that looks up the symbols in the global scope.
+    bool load_handle(boost::dll::fs::path sl, load_mode::type portable_mode, std::error_code &ec) {
         typedef int native_mode_t;
         native_mode_t native_mode = static_cast<native_mode_t>(portable_mode);
         unload();
@@ -83,9 +188,11 @@ public:
                 std::errc::bad_file_descriptor
             );
 
-            return;
+            return false;
         }
 
+        boost::dll::detail::load_event_timer resolution_timer;
+
         // Fixing modes
         if (!(native_mode & load_mode::rtld_now)) {
             native_mode |= load_mode::rtld_lazy;
@@ -112,32 +219,30 @@ public:
 
         native_mode = static_cast<unsigned>(native_mode) & ~static_cast<unsigned>(load_mode::search_system_folders);
 
-        // Trying to open with appended decorations
+        boost::dll::fs::path actual_path;
         if (!!(native_mode & load_mode::append_decorations)) {
             native_mode = static_cast<unsigned>(native_mode) & ~static_cast<unsigned>(load_mode::append_decorations);
+            actual_path = decorate(sl);
+        }
+        resolution_timer.report(load_phase::path_resolution, &sl, nullptr, nullptr, true);
 
-            boost::dll::fs::path actual_path = decorate(sl);
-            handle_ = dlopen(actual_path.c_str(), native_mode);
-            if (handle_) {
-                boost::dll::detail::reset_dlerror();
-                return;
+        // Trying to open with appended decorations
+        if (!actual_path.empty()) {
+            if (dlopen_impl(actual_path, native_mode)) {
+                return false;
             }
-            boost::dll::fs::error_code prog_loc_err;
-            boost::dll::fs::path loc = boost::dll::detail::program_location_impl(prog_loc_err);
-            if (boost::dll::fs::exists(actual_path) && !boost::dll::fs::equivalent(sl, loc, prog_loc_err)) {
+            if (boost::dll::fs::exists(actual_path) && !is_program_location(sl)) {
                 // decorated path exists : current error is not a bad file descriptor and we are not trying to load the executable itself
                 ec = std::make_error_code(
                     std::errc::executable_format_error
                 );
-                return;
+                return false;
             }
         }
 
         // Opening by exactly specified path
-        handle_ = dlopen(sl.c_str(), native_mode);
-        if (handle_) {
-            boost::dll::detail::reset_dlerror();
-            return;
+        if (dlopen_impl(sl, native_mode)) {
+            return false;
         }
 
         ec = std::make_error_code(
@@ -147,77 +252,61 @@ public:
         // Maybe user wanted to load the executable itself? Checking...
         // We assume that usually user wants to load a dynamic library not the executable itself, that's why
         // we try this only after traditional load fails.
-        boost::dll::fs::error_code prog_loc_err;
-        boost::dll::fs::path loc = boost::dll::detail::program_location_impl(prog_loc_err);
-        if (!prog_loc_err && boost::dll::fs::equivalent(sl, loc, prog_loc_err) && !prog_loc_err) {
+        if (is_program_location(sl)) {
             // As is known the function dlopen() loads the dynamic library file
             // named by the null-terminated string filename and returns an opaque
             // "handle" for the dynamic library. If filename is NULL, then the
             // returned handle is for the main program.
             ec.clear();
             boost::dll::detail::reset_dlerror();
+            boost::dll::detail::load_event_timer timer;
             handle_ = dlopen(nullptr, native_mode);
+            timer.report(load_phase::native_load, &sl, handle_, nullptr, !!handle_);
             if (!handle_) {
                 ec = std::make_error_code(
                     std::errc::bad_file_descriptor
                 );
             }
+            return true;
         }
-    }
 
-    bool is_loaded() const noexcept {
-        return (handle_ != 0);
+        return false;
     }
 
-    void unload() noexcept {
-        if (!is_loaded()) {
-            return;
+    // Returns true if the library was loaded.
+    bool dlopen_impl(const boost::dll::fs::path& load_path, int native_mode) noexcept {
+        boost::dll::detail::load_event_timer timer;
+        handle_ = dlopen(load_path.c_str(), native_mode);
+        timer.report(load_phase::native_load, &load_path, handle_, nullptr, !!handle_);
+        if (handle_) {
+            boost::dll::detail::reset_dlerror();
         }
-
-        dlclose(handle_);
-        handle_ = 0;
+        return !!handle_;
     }
 
-    void swap(shared_library_impl& rhs) noexcept {
-        boost::core::invoke_swap(handle_, rhs.handle_);
-    }
-
-    boost::dll::fs::path full_module_path(std::error_code &ec) const {
-        return boost::dll::detail::path_from_handle(handle_, ec);
-    }
-
-    static boost::dll::fs::path suffix() {
-        // https://sourceforge.net/p/predef/wiki/OperatingSystems/
-#if BOOST_OS_MACOS || BOOST_OS_IOS
-        return ".dylib";
-#else
-        return ".so";
-#endif
-    }
-
-    void* symbol_addr(const char* sb, std::error_code &ec) const noexcept {
-        // dlsym - obtain the address of a symbol from a dlopen object
-        void* const symbol = dlsym(handle_, sb);
-        if (symbol == nullptr) {
-            ec = std::make_error_code(
-                std::errc::invalid_seek
-            );
+    // Returns true if the handle is the one of the program itself, that looks up the symbols in the global scope.
+    static bool is_global_scope(native_handle_t handle) noexcept {
+        // dlopen(nullptr) never loads anything, it returns the same handle each time
+        native_handle_t const program = dlopen(nullptr, RTLD_LAZY);
+        if (!program) {
+            return false;
         }
-
-        // If handle does not refer to a valid object opened by dlopen(),
-        // or if the named symbol cannot be found within any of the objects
-        // associated with handle, dlsym() shall return NULL.
-        // More detailed diagnostic information shall be available through dlerror().
-
-        return symbol;
+        dlclose(program);
+        return program == handle;
     }
 
-    native_handle_t native() const noexcept {
-        return handle_;
+    // Returns true if `sl` points to the program itself.
+    static bool is_program_location(const boost::dll::fs::path& sl) {
+        boost::dll::detail::load_event_timer timer;
+        boost::dll::fs::error_code prog_loc_err;
+        boost::dll::fs::path loc = boost::dll::detail::program_location_impl(prog_loc_err);
+        const bool res = !prog_loc_err && boost::dll::fs::equivalent(sl, loc, prog_loc_err) && !prog_loc_err;
+        timer.report(load_phase::program_location_check, &sl, nullptr, nullptr, res);
+        return res;
     }
 
-private:
     native_handle_t         handle_;
+    boost::dll::detail::library_control_block* control_;
 };
 
 }}} // boost::dll::detail
@@ -0,0 +1,77 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_STREAM_READER_HPP
+#define BOOST_DLL_DETAIL_STREAM_READER_HPP
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/binary_reader.hpp>
+#include <boost/throw_exception.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+namespace boost { namespace dll { namespace detail {
+
+// Reads the binary file using std::ifstream.
+class stream_reader final: public boost::dll::binary_reader {
+    std::ifstream   f_;
+    std::uint64_t   size_ = 0;
+
+    void seek(std::uint64_t offset) {
+        if (offset > static_cast<std::uint64_t>((std::numeric_limits<std::streamoff>::max)())) {
+            boost::throw_exception(std::runtime_error("Integral overflow while getting info from binary file"));
+        }
+
+        // `seekg` will throw exceptions on an attempt to get outsize of the
+        // file size.
+        f_.seekg(static_cast<std::streamoff>(offset));
+    }
+
+public:
+    void open(const boost::dll::fs::path& library_path) {
+        f_.open(
+        #ifdef BOOST_DLL_USE_STD_FS
+            library_path,
+        //  Copied from boost/filesystem/fstream.hpp
+        #elif defined(BOOST_WINDOWS_API)  && (!defined(_CPPLIB_VER) || _CPPLIB_VER < 405 || defined(_STLPORT_VERSION))
+            // !Dinkumware || early Dinkumware || STLPort masquerading as Dinkumware
+            library_path.string().c_str(),  // use narrow, since wide not available
+        #else  // use the native c_str, which will be narrow on POSIX, wide on Windows
+            library_path.c_str(),
+        #endif
+            std::ios_base::in | std::ios_base::binary
+        );
+
+        f_.exceptions(
+            std::ios_base::failbit
+            | std::ifstream::badbit
+            | std::ifstream::eofbit
+        );
+
+        f_.seekg(0, std::ios_base::end);
+        size_ = static_cast<std::uint64_t>(f_.tellg());
+    }
+
+    std::uint64_t size() const override {
+        return size_;
+    }
+
+    void read(std::uint64_t offset, char* buffer, std::size_t size) override {
+        seek(offset);
+        f_.read(buffer, static_cast<std::streamsize>(size));
+    }
+};
+
+}}} // namespace boost::dll::detail
+
+#endif // BOOST_DLL_DETAIL_STREAM_READER_HPP
@@ -0,0 +1,74 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_WINDOWS_FILE_IDENTITY_HPP
+#define BOOST_DLL_DETAIL_WINDOWS_FILE_IDENTITY_HPP
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/detail/windows/path_from_handle.hpp> // last_error_code()
+
+#include <boost/winapi/access_rights.hpp>
+#include <boost/winapi/file_management.hpp>
+#include <boost/winapi/handles.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstdint>
+#include <system_error>
+
+namespace boost { namespace dll { namespace detail {
+
+// Values that change if the file is replaced or modified.
+struct file_identity {
+    std::uint64_t   inode;
+    std::uint64_t   size;
+    std::int64_t    mtime_ns;
+
+    bool operator==(const file_identity& other) const noexcept {
+        return inode == other.inode && size == other.size && mtime_ns == other.mtime_ns;
+    }
+};
+
+inline file_identity get_file_identity(const boost::dll::fs::path& p, std::error_code& ec) noexcept {
+    file_identity ret{0, 0, 0};
+
+    const boost::winapi::HANDLE_ file = boost::winapi::create_file(
+        p.c_str(),
+        0, // only the attributes are queried
+        boost::winapi::FILE_SHARE_READ_ | boost::winapi::FILE_SHARE_WRITE_ | boost::winapi::FILE_SHARE_DELETE_,
+        nullptr,
+        boost::winapi::OPEN_EXISTING_,
+        boost::winapi::FILE_ATTRIBUTE_NORMAL_,
+        nullptr
+    );
+    if (file == boost::winapi::INVALID_HANDLE_VALUE_) {
+        ec = boost::dll::detail::last_error_code();
+        return ret;
+    }
+
+    boost::winapi::BY_HANDLE_FILE_INFORMATION_ info;
+    if (!boost::winapi::GetFileInformationByHandle(file, &info)) {
+        ec = boost::dll::detail::last_error_code();
+        boost::winapi::CloseHandle(file);
+        return ret;
+    }
+    boost::winapi::CloseHandle(file);
+
+    ret.inode = (static_cast<std::uint64_t>(info.nFileIndexHigh) << 32) | info.nFileIndexLow;
+    ret.size = (static_cast<std::uint64_t>(info.nFileSizeHigh) << 32) | info.nFileSizeLow;
+
+    // FILETIME is in 100 nanoseconds intervals
+    ret.mtime_ns = static_cast<std::int64_t>(
+        (static_cast<std::uint64_t>(info.ftLastWriteTime.dwHighDateTime) << 32) | info.ftLastWriteTime.dwLowDateTime
+    ) * 100;
+    return ret;
+}
+
+}}} // namespace boost::dll::detail
+
+#endif // BOOST_DLL_DETAIL_WINDOWS_FILE_IDENTITY_HPP
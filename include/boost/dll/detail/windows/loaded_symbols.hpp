@@ -0,0 +1,77 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_WINDOWS_LOADED_SYMBOLS_HPP
+#define BOOST_DLL_DETAIL_WINDOWS_LOADED_SYMBOLS_HPP
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/detail/pe_info.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/winapi/dll.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace boost { namespace dll { namespace detail {
+
+// Export names of a module that is already mapped by the loader. `HMODULE` is the address of
+// the image, so the export directory is read right from memory without touching the file.
+class loaded_symbols {
+    using header_t = boost::dll::detail::IMAGE_NT_HEADERS_template<
+        typename std::conditional<sizeof(void*) == 8, boost::dll::detail::ULONGLONG_, boost::dll::detail::DWORD_>::type
+    >;
+
+    const char*                                         base_ = nullptr;
+    const boost::dll::detail::IMAGE_EXPORT_DIRECTORY_*  exports_ = nullptr;
+
+public:
+    // Returns false if the symbols could not be located in memory.
+    bool init(boost::winapi::HMODULE_ handle) noexcept {
+        // Modules loaded as data files have tagged handles and are not mapped as images
+        if (!handle || (reinterpret_cast<std::uintptr_t>(handle) & 3)) {
+            return false;
+        }
+
+        base_ = reinterpret_cast<const char*>(handle);
+        const auto* dos = reinterpret_cast<const boost::dll::detail::IMAGE_DOS_HEADER_*>(base_);
+        const auto* h = reinterpret_cast<const header_t*>(base_ + dos->e_lfanew);
+
+        static const unsigned int IMAGE_DIRECTORY_ENTRY_EXPORT_ = 0;
+        const boost::dll::detail::DWORD_ exports_rva = h->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT_].VirtualAddress;
+        if (exports_rva) {
+            exports_ = reinterpret_cast<const boost::dll::detail::IMAGE_EXPORT_DIRECTORY_*>(base_ + exports_rva);
+        }
+
+        return true;
+    }
+
+    // Calls `bool f(boost::core::string_view name)` for each exported symbol while `f` returns true.
+    // Returns false if the iteration was stopped by `f`.
+    template <class F>
+    bool for_each_symbol(F f) const {
+        if (!exports_) {
+            return true;
+        }
+
+        const auto* names = reinterpret_cast<const boost::dll::detail::DWORD_*>(base_ + exports_->AddressOfNames);
+        for (std::size_t i = 0; i < exports_->NumberOfNames; ++i) {
+            if (!f(boost::core::string_view(base_ + names[i]))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+}}} // namespace boost::dll::detail
+
+#endif // BOOST_DLL_DETAIL_WINDOWS_LOADED_SYMBOLS_HPP
@@ -0,0 +1,128 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_WINDOWS_MAPPED_FILE_HPP
+#define BOOST_DLL_DETAIL_WINDOWS_MAPPED_FILE_HPP
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/detail/windows/path_from_handle.hpp> // last_error_code()
+
+#include <boost/winapi/access_rights.hpp>
+#include <boost/winapi/file_management.hpp>
+#include <boost/winapi/file_mapping.hpp>
+#include <boost/winapi/handles.hpp>
+#include <boost/winapi/page_protection_flags.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+namespace boost { namespace dll { namespace detail {
+
+// Read-only mapping of a whole file into memory.
+class mapped_file {
+    const char*     data_;
+    std::size_t     size_;
+
+public:
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    mapped_file() noexcept
+        : data_(nullptr)
+        , size_(0)
+    {}
+
+    ~mapped_file() noexcept {
+        close();
+    }
+
+    bool open(const boost::dll::fs::path& p, std::error_code& ec) noexcept {
+        close();
+
+        const boost::winapi::HANDLE_ file = boost::winapi::create_file(
+            p.c_str(),
+            boost::winapi::GENERIC_READ_,
+            boost::winapi::FILE_SHARE_READ_,
+            nullptr,
+            boost::winapi::OPEN_EXISTING_,
+            boost::winapi::FILE_ATTRIBUTE_NORMAL_,
+            nullptr
+        );
+        if (file == boost::winapi::INVALID_HANDLE_VALUE_) {
+            ec = boost::dll::detail::last_error_code();
+            return false;
+        }
+
+        boost::winapi::LARGE_INTEGER_ file_size;
+        if (!boost::winapi::GetFileSizeEx(file, &file_size)) {
+            ec = boost::dll::detail::last_error_code();
+            boost::winapi::CloseHandle(file);
+            return false;
+        }
+
+        // Empty files could not be mapped
+        if (file_size.QuadPart <= 0 || static_cast<std::uint64_t>(file_size.QuadPart) > static_cast<std::size_t>(-1)) {
+            ec = std::make_error_code(std::errc::invalid_argument);
+            boost::winapi::CloseHandle(file);
+            return false;
+        }
+
+        const boost::winapi::HANDLE_ mapping = boost::winapi::create_file_mapping(
+            file, nullptr, boost::winapi::PAGE_READONLY_, 0, 0, static_cast<const boost::winapi::WCHAR_*>(nullptr)
+        );
+        if (!mapping) {
+            ec = boost::dll::detail::last_error_code();
+            boost::winapi::CloseHandle(file);
+            return false;
+        }
+
+        void* const p_data = boost::winapi::MapViewOfFile(mapping, boost::winapi::FILE_MAP_READ_, 0, 0, 0);
+        if (!p_data) {
+            ec = boost::dll::detail::last_error_code();
+        }
+
+        // View stays valid after the handles are closed
+        boost::winapi::CloseHandle(mapping);
+        boost::winapi::CloseHandle(file);
+
+        if (!p_data) {
+            return false;
+        }
+
+        data_ = static_cast<const char*>(p_data);
+        size_ = static_cast<std::size_t>(file_size.QuadPart);
+        return true;
+    }
+
+    void close() noexcept {
+        if (data_) {
+            boost::winapi::UnmapViewOfFile(data_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    bool is_open() const noexcept {
+        return !!data_;
+    }
+
+    const char* data() const noexcept {
+        return data_;
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+};
+
+}}} // namespace boost::dll::detail
+
+#endif // BOOST_DLL_DETAIL_WINDOWS_MAPPED_FILE_HPP
@@ -0,0 +1,42 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_WINDOWS_PREFETCH_FILE_HPP
+#define BOOST_DLL_DETAIL_WINDOWS_PREFETCH_FILE_HPP
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/detail/windows/mapped_file.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstddef>
+#include <system_error>
+
+namespace boost { namespace dll { namespace detail {
+
+// Reads the whole file into the file cache, so that the following loading of the file
+// does not wait for the disk.
+inline void prefetch_file(const boost::dll::fs::path& p, std::error_code& ec) noexcept {
+    boost::dll::detail::mapped_file mapping;
+    if (!mapping.open(p, ec)) {
+        return;
+    }
+
+    // Touching a byte on each page faults the whole file in
+    const std::size_t page_size = 4096;
+    const volatile char* data = mapping.data();
+    char sum = 0;
+    for (std::size_t i = 0; i < mapping.size(); i += page_size) {
+        sum ^= data[i];
+    }
+    static_cast<void>(sum);
+}
+
+}}} // namespace boost::dll::detail
+
+#endif // BOOST_DLL_DETAIL_WINDOWS_PREFETCH_FILE_HPP
@@ -10,6 +10,8 @@
 
 #include <boost/dll/config.hpp>
 #include <boost/dll/shared_library_load_mode.hpp>
+#include <boost/dll/load_observer.hpp>
+#include <boost/dll/detail/library_control_block.hpp>
 #include <boost/dll/detail/aggressive_ptr_cast.hpp>
 #include <boost/dll/detail/system_error.hpp>
 #include <boost/dll/detail/windows/path_from_handle.hpp>
@@ -40,12 +42,15 @@ public:
 
     shared_library_impl(shared_library_impl&& sl) noexcept
         : handle_(sl.handle_)
+        , control_(sl.control_)
     {
         sl.handle_ = nullptr;
+        sl.control_ = nullptr;
     }
 
     explicit shared_library_impl(native_handle_t handle) noexcept
         : handle_(handle)
+        , control_(handle ? boost::dll::detail::library_control_block::create() : nullptr)
     {}
 
     shared_library_impl & operator=(shared_library_impl&& sl) noexcept {
@@ -60,73 +65,52 @@ public:
     }
 
     void load(boost::dll::fs::path sl, load_mode::type portable_mode, std::error_code &ec) {
-        typedef boost::winapi::DWORD_ native_mode_t;
-        native_mode_t native_mode = static_cast<native_mode_t>(portable_mode);
-        unload();
-
-        if (!sl.is_absolute() && !(native_mode & load_mode::search_system_folders)) {
-            boost::dll::fs::error_code current_path_ec;
-            boost::dll::fs::path prog_loc = boost::dll::fs::current_path(current_path_ec);
-
-            if (!current_path_ec) {
-                prog_loc /= sl;
-                sl.swap(prog_loc);
-            }
+        load_handle(std::move(sl), portable_mode, ec);
+        if (handle_) {
+            control_ = boost::dll::detail::library_control_block::create();
         }
-        native_mode = static_cast<unsigned>(native_mode) & ~static_cast<unsigned>(load_mode::search_system_folders);
-
-        // Trying to open with appended decorations
-        if (!!(native_mode & load_mode::append_decorations)) {
-            native_mode = static_cast<unsigned>(native_mode) & ~static_cast<unsigned>(load_mode::append_decorations);
+    }
 
-            if (load_impl(decorate(sl), native_mode, ec)) {
-                return;
-            }
+    bool is_loaded() const noexcept {
+        return (handle_ != 0);
+    }
 
-            // MinGW loves 'lib' prefix and puts it even on Windows platform.
-            const boost::dll::fs::path mingw_load_path = (
-                sl.has_parent_path()
-                ? sl.parent_path() / L"lib"
-                : L"lib"
-            ).native() + sl.filename().native() + suffix().native();
-            if (load_impl(mingw_load_path, native_mode, ec)) {
-                return;
-            }
+    void unload() noexcept {
+        if (!is_loaded()) {
+            return;
         }
 
-        // From MSDN: If the string specifies a module name without a path and the
-        // file name extension is omitted, the function appends the default library
-        // extension .dll to the module name.
-        //
-        // From experiments: Default library extension appended to the module name even if
-        // we have some path. So we do not check for path, only for extension. We can not be sure that
-        // such behavior remain across all platforms, so we add L"." by hand.
-        if (sl.has_extension()) {
-            handle_ = boost::winapi::LoadLibraryExW(sl.c_str(), 0, native_mode);
-        } else {
-            handle_ = boost::winapi::LoadLibraryExW((sl.native() + L".").c_str(), 0, native_mode);
+        if (!control_ || control_->release()) {
+            boost::dll::detail::load_event_timer timer;
+            boost::winapi::FreeLibrary(handle_);
+            timer.report(load_phase::unload, nullptr, handle_, nullptr, true);
         }
+        handle_ = 0;
+        control_ = nullptr;
+    }
 
-        // LoadLibraryExW method is capable of self loading from program_location() path. No special actions
-        // must be taken to allow self loading.
-        if (!handle_) {
-            ec = boost::dll::detail::last_error_code();
+    // Makes *this reference the same native handle as `sl` by incrementing the reference count.
+    // Returns false if `sl` has no control block and the library must be loaded by path.
+    bool share(const shared_library_impl& sl) noexcept {
+        if (!sl.control_) {
+            return false;
         }
-    }
 
-    bool is_loaded() const noexcept {
-        return (handle_ != 0);
+        sl.control_->add_ref();
+        unload();
+        handle_ = sl.handle_;
+        control_ = sl.control_;
+        return true;
     }
 
-    void unload() noexcept {
-        if (handle_) {
-            boost::winapi::FreeLibrary(handle_);
-            handle_ = 0;
-        }
+    // Returns the number of shared_library instances that reference the native handle through the control block.
+    std::size_t use_count() const noexcept {
+        return control_ ? control_->use_count() : static_cast<std::size_t>(is_loaded());
     }
 
     void swap(shared_library_impl& rhs) noexcept {
         boost::core::invoke_swap(handle_, rhs.handle_);
+        boost::core::invoke_swap(control_, rhs.control_);
     }
 
     boost::dll::fs::path full_module_path(std::error_code &ec) const {
@@ -152,9 +136,13 @@ public:
         // Judging by the documentation of GetProcAddress
         // there is no version for UNICODE on desktop/server Windows, because
         // names of functions are stored in narrow characters.
+        boost::dll::detail::load_event_timer timer;
         void* const symbol = boost::dll::detail::aggressive_ptr_cast<void*>(
             boost::winapi::get_proc_address(handle_, sb)
         );
+        // Ordinals passed as names (MAKEINTRESOURCE) are not reported as names
+        timer.report(load_phase::symbol_lookup, nullptr, handle_,
+            (reinterpret_cast<boost::winapi::ULONG_PTR_>(sb) >> 16) ? sb : nullptr, !!symbol);
         if (symbol == nullptr) {
             ec = boost::dll::detail::last_error_code();
         }
@@ -162,14 +150,88 @@ public:
         return symbol;
     }
 
+    // Same as symbol_addr(), but looks up the address in the cache of the control block first.
+    void* cached_symbol_addr(const char* sb, std::error_code &ec) const noexcept {
+        // Ordinals passed as names (MAKEINTRESOURCE) are not cached
+        if (!control_ || !(reinterpret_cast<boost::winapi::ULONG_PTR_>(sb) >> 16)) {
+            return symbol_addr(sb, ec);
+        }
+
+        return control_->symbols().find_or_insert(sb, [this, sb, &ec]() noexcept {
+            return symbol_addr(sb, ec);
+        });
+    }
+
     native_handle_t native() const noexcept {
         return handle_;
     }
 
 private:
+    // Loads the native handle without creating the control block. Internal step of load().
+    void load_handle(boost::dll::fs::path sl, load_mode::type portable_mode, std::error_code &ec) {
+        typedef boost::winapi::DWORD_ native_mode_t;
+        native_mode_t native_mode = static_cast<native_mode_t>(portable_mode);
+        unload();
+
+        boost::dll::detail::load_event_timer resolution_timer;
+        if (!sl.is_absolute() && !(native_mode & load_mode::search_system_folders)) {
+            boost::dll::fs::error_code current_path_ec;
+            boost::dll::fs::path prog_loc = boost::dll::fs::current_path(current_path_ec);
+
+            if (!current_path_ec) {
+                prog_loc /= sl;
+                sl.swap(prog_loc);
+            }
+        }
+        native_mode = static_cast<unsigned>(native_mode) & ~static_cast<unsigned>(load_mode::search_system_folders);
+        resolution_timer.report(load_phase::path_resolution, &sl, nullptr, nullptr, true);
+
+        // Trying to open with appended decorations
+        if (!!(native_mode & load_mode::append_decorations)) {
+            native_mode = static_cast<unsigned>(native_mode) & ~static_cast<unsigned>(load_mode::append_decorations);
+
+            if (load_impl(decorate(sl), native_mode, ec)) {
+                return;
+            }
+
+            // MinGW loves 'lib' prefix and puts it even on Windows platform.
+            const boost::dll::fs::path mingw_load_path = (
+                sl.has_parent_path()
+                ? sl.parent_path() / L"lib"
+                : L"lib"
+            ).native() + sl.filename().native() + suffix().native();
+            if (load_impl(mingw_load_path, native_mode, ec)) {
+                return;
+            }
+        }
+
+        // From MSDN: If the string specifies a module name without a path and the
+        // file name extension is omitted, the function appends the default library
+        // extension .dll to the module name.
+        //
+        // From experiments: Default library extension appended to the module name even if
+        // we have some path. So we do not check for path, only for extension. We can not be sure that
+        // such behavior remain across all platforms, so we add L"." by hand.
+        boost::dll::detail::load_event_timer timer;
+        if (sl.has_extension()) {
+            handle_ = boost::winapi::LoadLibraryExW(sl.c_str(), 0, native_mode);
+        } else {
+            handle_ = boost::winapi::LoadLibraryExW((sl.native() + L".").c_str(), 0, native_mode);
+        }
+        timer.report(load_phase::native_load, &sl, handle_, nullptr, !!handle_);
+
+        // LoadLibraryExW method is capable of self loading from program_location() path. No special actions
+        // must be taken to allow self loading.
+        if (!handle_) {
+            ec = boost::dll::detail::last_error_code();
+        }
+    }
+
     // Returns true if this load attempt should be the last one.
     bool load_impl(const boost::dll::fs::path &load_path, boost::winapi::DWORD_ mode, std::error_code &ec) {
+        boost::dll::detail::load_event_timer timer;
         handle_ = boost::winapi::LoadLibraryExW(load_path.c_str(), 0, mode);
+        timer.report(load_phase::native_load, &load_path, handle_, nullptr, !!handle_);
         if (handle_) {
             return true;
         }
@@ -191,6 +253,7 @@ private:
     }
 
     native_handle_t handle_;
+    boost::dll::detail::library_control_block* control_;
 };
 
 }}} // boost::dll::detail
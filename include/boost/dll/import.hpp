@@ -13,6 +13,7 @@
 
 #include <memory>  // std::addressof
 #include <type_traits>
+#include <utility>  // std::move
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
 # pragma once
@@ -26,40 +27,100 @@
 namespace boost { namespace dll {
 
 
-namespace detail {
+/*!
+* \brief Callable object that is returned by the boost::dll::import_symbol and boost::dll::import_alias
+* functions for function types.
+*
+* Stores the pointer to the function directly, so a call is a single indirect call that is as cheap as a call
+* through a plain function pointer. The library is kept loaded by a separate lifetime token, that is a copy of the
+* boost::dll::shared_library and is never touched on the call path.
+*
+* \b Example:
+* \code
+* boost::dll::raw_function<int(int)> f = boost::dll::import_symbol<int(int)>("test_lib.so", "integer_func_name");
+* int (*direct)(int) = f.get(); // valid while `f` or any other copy of f.lifetime() exists
+* \endcode
+*
+* \tparam T Function type.
+*/
+template <class T>
+class raw_function {
+    static_assert(std::is_function<T>::value, "boost::dll::raw_function<T>: T must be a function type");
+
+    T*                          f_;
+    boost::dll::shared_library  lifetime_;
+
+public:
+    /*!
+    * Creates an instance from the pointer to the function and the library that contains it.
+    * \param func_ptr Pointer to the function from the `lifetime` library.
+    * \param lifetime Library that contains the function.
+    * \throws Nothing.
+    */
+    raw_function(T* func_ptr, boost::dll::shared_library lifetime) noexcept
+        : f_(func_ptr)
+        , lifetime_(std::move(lifetime))
+    {}
+
+    // Compilation error at this point means that imported function
+    // was called with unmatching parameters.
+    //
+    // Example:
+    // auto f = dll::import_symbol<void(int)>("function", "lib.so");
+    // f("Hello");  // error: invalid conversion from 'const char*' to 'int'
+    // f(1, 2);     // error: too many arguments to function
+    // f();         // error: too few arguments to function
+    template <class... Args>
+    inline auto operator()(Args&&... args) const
+        -> decltype( (*f_)(static_cast<Args&&>(args)...) )
+    {
+        return (*f_)(static_cast<Args&&>(args)...);
+    }
+
+    /*!
+    * \return Pointer to the function. Pointer is valid while the library returned by lifetime() is loaded.
+    * \throws Nothing.
+    */
+    T* get() const noexcept {
+        return f_;
+    }
+
+    /*!
+    * \return Library that contains the function.
+    * \throws Nothing.
+    */
+    const boost::dll::shared_library& lifetime() const noexcept {
+        return lifetime_;
+    }
+};
 
-    template <class T>
-    class library_function {
-        // Copying of `boost::dll::shared_library` is very expensive, so we use a `shared_ptr` to make it faster.
-        boost::dll::detail::shared_ptr<T>   f_;
-
-    public:
-        inline library_function(const boost::dll::detail::shared_ptr<shared_library>& lib, T* func_ptr) noexcept
-            : f_(lib, func_ptr)
-        {}
-
-        // Compilation error at this point means that imported function
-        // was called with unmatching parameters.
-        //
-        // Example:
-        // auto f = dll::import_symbol<void(int)>("function", "lib.so");
-        // f("Hello");  // error: invalid conversion from 'const char*' to 'int'
-        // f(1, 2);     // error: too many arguments to function
-        // f();         // error: too few arguments to function
-        template <class... Args>
-        inline auto operator()(Args&&... args) const
-            -> decltype( (*f_)(static_cast<Args&&>(args)...) )
-        {
-            return (*f_)(static_cast<Args&&>(args)...);
-        }
-    };
+namespace detail {
 
     template <class T>
     using import_type = typename std::conditional<
         std::is_object<T>::value,
         boost::dll::detail::shared_ptr<T>,
-        boost::dll::detail::library_function<T>
+        boost::dll::raw_function<T>
     >::type;
+
+    template <class T>
+    inline boost::dll::detail::shared_ptr<T> make_import(boost::dll::shared_library&& lib, T* addr, std::true_type /*is_object*/) {
+        return boost::dll::detail::shared_ptr<T>(
+            boost::dll::detail::make_shared<boost::dll::shared_library>(std::move(lib)),
+            addr
+        );
+    }
+
+    template <class T>
+    inline boost::dll::raw_function<T> make_import(boost::dll::shared_library&& lib, T* addr, std::false_type /*is_object*/) noexcept {
+        return boost::dll::raw_function<T>(addr, std::move(lib));
+    }
+
+    template <class T>
+    inline import_type<T> make_import(boost::dll::shared_library&& lib, T* addr) {
+        return boost::dll::detail::make_import(std::move(lib), addr, std::is_object<T>());
+    }
+
 } // namespace detail
 
 
@@ -98,7 +159,7 @@ namespace detail {
 * \param name Null-terminated C or C++ mangled name of the function to import. Can handle std::string, char*, const char*.
 * \param mode An mode that will be used on library load.
 *
-* \return callable object if T is a function type, or std::shared_ptr<T> (boost::shared_ptr<T> if
+* \return boost::dll::raw_function<T> if T is a function type, or std::shared_ptr<T> (boost::shared_ptr<T> if
 * BOOST_DLL_USE_BOOST_SHARED_PTR is defined) if T is an object type.
 *
 * \throw \forcedlinkfs{system_error} if symbol does not exist or if the DLL/DSO was not loaded.
@@ -108,11 +169,9 @@ template <class T>
 BOOST_DLL_IMPORT_RESULT_TYPE import_symbol(const boost::dll::fs::path& lib, const char* name,
     load_mode::type mode = load_mode::default_mode)
 {
-    using type = boost::dll::detail::import_type<T>;
-
-    auto p = boost::dll::detail::make_shared<boost::dll::shared_library>(lib, mode);
-    auto* addr = std::addressof(p->get<T>(name));
-    return type(std::move(p), addr);
+    boost::dll::shared_library l(lib, mode);
+    auto* addr = std::addressof(l.get<T>(name));
+    return boost::dll::detail::make_import<T>(std::move(l), addr);
 }
 
 //! \overload boost::dll::import_symbol(const boost::dll::fs::path& lib, const char* name, load_mode::type mode)
@@ -126,10 +185,8 @@ BOOST_DLL_IMPORT_RESULT_TYPE import_symbol(const boost::dll::fs::path& lib, cons
 //! \overload boost::dll::import_symbol(const boost::dll::fs::path& lib, const char* name, load_mode::type mode)
 template <class T>
 BOOST_DLL_IMPORT_RESULT_TYPE import_symbol(const shared_library& lib, const char* name) {
-    using type = boost::dll::detail::import_type<T>;
-
-    auto p = boost::dll::detail::make_shared<boost::dll::shared_library>(lib);
-    return type(p, std::addressof(p->get<T>(name)));
+    auto* addr = std::addressof(lib.get<T>(name));
+    return boost::dll::detail::make_import<T>(boost::dll::shared_library(lib), addr);
 }
 
 //! \overload boost::dll::import_symbol(const boost::dll::fs::path& lib, const char* name, load_mode::type mode)
@@ -141,13 +198,8 @@ BOOST_DLL_IMPORT_RESULT_TYPE import_symbol(const shared_library& lib, const std:
 //! \overload boost::dll::import_symbol(const boost::dll::fs::path& lib, const char* name, load_mode::type mode)
 template <class T>
 BOOST_DLL_IMPORT_RESULT_TYPE import_symbol(shared_library&& lib, const char* name) {
-    using type = boost::dll::detail::import_type<T>;
-
-    auto p = boost::dll::detail::make_shared<boost::dll::shared_library>(
-        std::move(lib)
-    );
-    auto* addr = std::addressof(p->get<T>(name));
-    return type(std::move(p), addr);
+    auto* addr = std::addressof(lib.get<T>(name));
+    return boost::dll::detail::make_import<T>(std::move(lib), addr);
 }
 
 //! \overload boost::dll::import_symbol(const boost::dll::fs::path& lib, const char* name, load_mode::type mode)
@@ -192,7 +244,7 @@ BOOST_DLL_IMPORT_RESULT_TYPE import_symbol(shared_library&& lib, const std::stri
 * \param name Null-terminated C or C++ mangled name of the function or variable to import. Can handle std::string, char*, const char*.
 * \param mode An mode that will be used on library load.
 *
-* \return callable object if T is a function type, or std::shared_ptr<T> (boost::shared_ptr<T> if
+* \return boost::dll::raw_function<T> if T is a function type, or std::shared_ptr<T> (boost::shared_ptr<T> if
 * BOOST_DLL_USE_BOOST_SHARED_PTR is defined) if T is an object type.
 *
 * \throw \forcedlinkfs{system_error} if symbol does not exist or if the DLL/DSO was not loaded.
@@ -202,11 +254,9 @@ template <class T>
 BOOST_DLL_IMPORT_RESULT_TYPE import_alias(const boost::dll::fs::path& lib, const char* name,
     load_mode::type mode = load_mode::default_mode)
 {
-    using type = boost::dll::detail::import_type<T>;
-
-    auto p = boost::dll::detail::make_shared<boost::dll::shared_library>(lib, mode);
-    auto* addr = p->get<T*>(name);
-    return type(std::move(p), addr);
+    boost::dll::shared_library l(lib, mode);
+    auto* addr = l.get<T*>(name);
+    return boost::dll::detail::make_import<T>(std::move(l), addr);
 }
 
 //! \overload boost::dll::import_alias(const boost::dll::fs::path& lib, const char* name, load_mode::type mode)
@@ -220,11 +270,8 @@ BOOST_DLL_IMPORT_RESULT_TYPE import_alias(const boost::dll::fs::path& lib, const
 //! \overload boost::dll::import_alias(const boost::dll::fs::path& lib, const char* name, load_mode::type mode)
 template <class T>
 BOOST_DLL_IMPORT_RESULT_TYPE import_alias(const shared_library& lib, const char* name) {
-    using type = boost::dll::detail::import_type<T>;
-
-    auto p = boost::dll::detail::make_shared<boost::dll::shared_library>(lib);
-    auto* addr = p->get<T*>(name);
-    return type(std::move(p), addr);
+    auto* addr = lib.get<T*>(name);
+    return boost::dll::detail::make_import<T>(boost::dll::shared_library(lib), addr);
 }
 
 //! \overload boost::dll::import_alias(const boost::dll::fs::path& lib, const char* name, load_mode::type mode)
@@ -236,13 +283,8 @@ BOOST_DLL_IMPORT_RESULT_TYPE import_alias(const shared_library& lib, const std::
 //! \overload boost::dll::import_alias(const boost::dll::fs::path& lib, const char* name, load_mode::type mode)
 template <class T>
 BOOST_DLL_IMPORT_RESULT_TYPE import_alias(shared_library&& lib, const char* name) {
-    using type = boost::dll::detail::import_type<T>;
-
-    auto p = boost::dll::detail::make_shared<boost::dll::shared_library>(
-        std::move(lib)
-    );
-    auto* addr = p->get<T*>(name);
-    return type(std::move(p), addr);
+    auto* addr = lib.get<T*>(name);
+    return boost::dll::detail::make_import<T>(std::move(lib), addr);
 }
 
 //! \overload boost::dll::import_alias(const boost::dll::fs::path& lib, const char* name, load_mode::type mode)
@@ -0,0 +1,211 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_INSPECT_ALL_HPP
+#define BOOST_DLL_INSPECT_ALL_HPP
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/library_info.hpp>
+#include <boost/core/detail/string_view.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/// \file boost/dll/inspect_all.hpp
+/// \brief Contains the boost::dll::inspect_all functions for parallel extraction of information from
+/// multiple binaries.
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Result of the inspection of a single binary file by boost::dll::inspect_all.
+*/
+struct inspection_result {
+    /// Path to the binary file.
+    boost::dll::fs::path path;
+
+    /// Format of the binary. Meaningful only if there is no `error`.
+    boost::dll::library_info::binary_format format = boost::dll::library_info::binary_format::elf64;
+
+    /// Exported symbols that satisfy the predicate.
+    std::vector<std::string> symbols;
+
+    /// Exception that happened during the inspection or an empty `std::exception_ptr`.
+    std::exception_ptr error;
+};
+
+/// @cond
+namespace detail {
+
+template <class Range>
+std::vector<inspection_result> make_inspection_results(const Range& paths) {
+    std::vector<inspection_result> results;
+    for (const auto& p : paths) {
+        results.emplace_back();
+        results.back().path = boost::dll::fs::path(p);
+    }
+    return results;
+}
+
+template <class Predicate>
+void inspect_one(inspection_result& result, Predicate& pred) noexcept {
+    try {
+        boost::dll::library_info info(result.path, boost::dll::library_info::read_mode::memory_mapped);
+        result.format = info.format();
+        info.for_each_symbol([&result, &pred](boost::core::string_view name) {
+            if (pred(name)) {
+                result.symbols.emplace_back(name.data(), name.size());
+            }
+        });
+    } catch (...) {
+        result.symbols.clear();
+        result.error = std::current_exception();
+    }
+}
+
+} // namespace detail
+/// @endcond
+
+/*!
+* Extracts information from multiple binaries in parallel, using the user provided executor.
+*
+* \b Example:
+* \code
+* auto results = boost::dll::inspect_all(
+*     boost::dll::fs::recursive_directory_iterator(plugins_directory),
+*     [](boost::core::string_view name) { return name == "create_plugin"; },
+*     [&pool](std::function<void()> task) { boost::asio::post(pool, std::move(task)); }
+* );
+* \endcode
+*
+* \param paths Range of paths (or of directory entries) to the binaries.
+* \param pred Callable with `bool(boost::core::string_view)` signature that selects the exported symbols
+* to report. Called concurrently from multiple threads.
+* \param executor Callable with `void(std::function<void()>)` signature that schedules the task for execution.
+* Function waits for all the scheduled tasks to finish.
+* \return Results for each binary in the order of the `paths` range. Errors, including the
+* not native format errors, are reported through the inspection_result::error.
+* \throws std::bad_alloc and exceptions thrown by the executor.
+*/
+template <class Range, class Predicate, class Executor>
+std::vector<inspection_result> inspect_all(const Range& paths, Predicate pred, Executor&& executor) {
+    std::vector<inspection_result> results = boost::dll::detail::make_inspection_results(paths);
+
+    std::mutex m;
+    std::condition_variable cv;
+    std::size_t remaining = 0;
+
+    std::exception_ptr scheduling_error;
+    for (inspection_result& result : results) {
+        {
+            std::lock_guard<std::mutex> lock(m);
+            ++remaining;
+        }
+
+        try {
+            executor(std::function<void()>([&result, &pred, &m, &cv, &remaining]() {
+                boost::dll::detail::inspect_one(result, pred);
+
+                std::lock_guard<std::mutex> lock(m);
+                if (--remaining == 0) {
+                    cv.notify_one();
+                }
+            }));
+        } catch (...) {
+            scheduling_error = std::current_exception();
+
+            std::lock_guard<std::mutex> lock(m);
+            --remaining;
+            break;
+        }
+    }
+
+    // Scheduled tasks reference the local variables, so waiting for them even on error
+    std::unique_lock<std::mutex> lock(m);
+    cv.wait(lock, [&remaining]() { return remaining == 0; });
+
+    if (scheduling_error) {
+        std::rethrow_exception(scheduling_error);
+    }
+
+    return results;
+}
+
+/*!
+* Extracts information from multiple binaries in parallel, using up to `std::thread::hardware_concurrency()` threads.
+*
+* \b Example:
+* \code
+* auto results = boost::dll::inspect_all(
+*     boost::dll::fs::recursive_directory_iterator(plugins_directory),
+*     [](boost::core::string_view name) { return name == "create_plugin"; }
+* );
+* for (const boost::dll::inspection_result& r : results) {
+*     if (!r.error && !r.symbols.empty()) {
+*         plugins.emplace_back(r.path);
+*     }
+* }
+* \endcode
+*
+* \param paths Range of paths (or of directory entries) to the binaries.
+* \param pred Callable with `bool(boost::core::string_view)` signature that selects the exported symbols
+* to report. Called concurrently from multiple threads.
+* \return Results for each binary in the order of the `paths` range. Errors, including the
+* not native format errors, are reported through the inspection_result::error.
+* \throws std::bad_alloc.
+*/
+template <class Range, class Predicate>
+std::vector<inspection_result> inspect_all(const Range& paths, Predicate pred) {
+    std::vector<inspection_result> results = boost::dll::detail::make_inspection_results(paths);
+
+    std::atomic<std::size_t> next{0};
+    const auto worker = [&results, &pred, &next]() {
+        for (std::size_t i = next++; i < results.size(); i = next++) {
+            boost::dll::detail::inspect_one(results[i], pred);
+        }
+    };
+
+    const std::size_t threads_count = (std::min)(
+        static_cast<std::size_t>((std::max)(std::thread::hardware_concurrency(), 1u)),
+        results.size()
+    );
+
+    // Current thread is also a worker
+    std::vector<std::thread> threads;
+    threads.reserve(threads_count);
+    for (std::size_t i = 1; i < threads_count; ++i) {
+        try {
+            threads.emplace_back(worker);
+        } catch (const std::system_error&) {
+            break; // Proceeding with the already started threads
+        }
+    }
+
+    worker();
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    return results;
+}
+
+}} // namespace boost::dll
+
+#endif // BOOST_DLL_INSPECT_ALL_HPP
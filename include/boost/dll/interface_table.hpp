@@ -0,0 +1,148 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_INTERFACE_TABLE_HPP
+#define BOOST_DLL_INTERFACE_TABLE_HPP
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/alias.hpp>
+#include <boost/dll/shared_library.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <string>
+#include <type_traits>
+
+/// \file boost/dll/interface_table.hpp
+/// \brief Contains the boost::dll::interface_table class and macros for exporting plugin interfaces
+/// as tables of function pointers.
+
+namespace boost { namespace dll {
+
+#ifdef BOOST_DLL_DOXYGEN
+/*!
+* \brief Exports a table of function pointers (or any other trivially copyable structure) under the name `ExportName`.
+* Same as \forcedmacrolink{BOOST_DLL_ALIAS}(Table, ExportName).
+*
+* \b Example:
+* \code
+* // plugin_api.hpp, shared between the plugin and the host
+* struct calculator_api {
+*     int (*add)(int, int);
+*     int (*mul)(int, int);
+* };
+*
+* // plugin.cpp
+* namespace my_plugin {
+*     int add(int a, int b) { return a + b; }
+*     int mul(int a, int b) { return a * b; }
+*     const calculator_api table = { &add, &mul };
+* }
+* BOOST_DLL_INTERFACE_TABLE(my_plugin::table, calculator_api_v1)
+* \endcode
+*
+* \param Table Fully qualified name of the structure instance.
+* \param ExportName Name of the exported symbol, must be a valid C identifier.
+*/
+#define BOOST_DLL_INTERFACE_TABLE(Table, ExportName)
+
+/*!
+* \brief Same as \forcedmacrolink{BOOST_DLL_INTERFACE_TABLE} but puts the symbol into the `SectionName` section.
+* Same as \forcedmacrolink{BOOST_DLL_ALIAS_SECTIONED}(Table, ExportName, SectionName).
+*/
+#define BOOST_DLL_INTERFACE_TABLE_SECTIONED(Table, ExportName, SectionName)
+#else
+#define BOOST_DLL_INTERFACE_TABLE(Table, ExportName)                            \
+    BOOST_DLL_ALIAS(Table, ExportName)                                          \
+    /**/
+
+#define BOOST_DLL_INTERFACE_TABLE_SECTIONED(Table, ExportName, SectionName)     \
+    BOOST_DLL_ALIAS_SECTIONED(Table, ExportName, SectionName)                   \
+    /**/
+#endif
+
+/*!
+* \brief Imported table of function pointers that was exported by \forcedmacrolink{BOOST_DLL_INTERFACE_TABLE}.
+*
+* The whole table is resolved with a single symbol lookup and copied. The instance holds a single copy of the
+* shared_library, calls through the table are plain indirect calls without any wrappers or reference counting.
+*
+* \b Example:
+* \code
+* boost::dll::interface_table<calculator_api> calc("plugins/calculator", "calculator_api_v1",
+*     boost::dll::load_mode::append_decorations);
+* int result = calc->add(2, 2);
+* \endcode
+*
+* \tparam Table Trivially copyable structure, the same as was used on the exporting side.
+*/
+template <class Table>
+class interface_table {
+    static_assert(std::is_trivially_copyable<Table>::value, "boost::dll::interface_table<Table>: Table must be trivially copyable");
+
+    boost::dll::shared_library  lib_;
+    Table                       table_;
+
+public:
+    /*!
+    * Imports the table from the loaded library.
+    * \param lib Loaded library, its copy is stored in the interface_table.
+    * \param export_name Name that was used in the \forcedmacrolink{BOOST_DLL_INTERFACE_TABLE}.
+    * \throws \forcedlinkfs{system_error} if symbol does not exist or if the DLL/DSO was not loaded.
+    */
+    interface_table(const boost::dll::shared_library& lib, const char* export_name)
+        : lib_(lib)
+        , table_(lib_.get_alias<const Table>(export_name))
+    {}
+
+    //! \overload interface_table(const boost::dll::shared_library& lib, const char* export_name)
+    interface_table(const boost::dll::shared_library& lib, const std::string& export_name)
+        : interface_table(lib, export_name.c_str())
+    {}
+
+    /*!
+    * Loads the library and imports the table from it.
+    * \param lib_path Path to the library, same as for shared_library::load().
+    * \param export_name Name that was used in the \forcedmacrolink{BOOST_DLL_INTERFACE_TABLE}.
+    * \param mode A mode that will be used on library load.
+    * \throws \forcedlinkfs{system_error} if the library could not be loaded or if symbol does not exist.
+    */
+    interface_table(const boost::dll::fs::path& lib_path, const char* export_name, load_mode::type mode = load_mode::default_mode)
+        : interface_table(boost::dll::shared_library(lib_path, mode), export_name)
+    {}
+
+    //! \overload interface_table(const boost::dll::fs::path& lib_path, const char* export_name, load_mode::type mode = load_mode::default_mode)
+    interface_table(const boost::dll::fs::path& lib_path, const std::string& export_name, load_mode::type mode = load_mode::default_mode)
+        : interface_table(lib_path, export_name.c_str(), mode)
+    {}
+
+    /*!
+    * \return Imported table.
+    * \throws Nothing.
+    */
+    const Table& operator*() const noexcept {
+        return table_;
+    }
+
+    //! \overload const Table& operator*() const noexcept
+    const Table* operator->() const noexcept {
+        return &table_;
+    }
+
+    /*!
+    * \return Library that exported the table.
+    * \throws Nothing.
+    */
+    const boost::dll::shared_library& library() const noexcept {
+        return lib_;
+    }
+};
+
+}} // namespace boost::dll
+
+#endif // BOOST_DLL_INTERFACE_TABLE_HPP
@@ -0,0 +1,436 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_LIBRARY_INDEX_HPP
+#define BOOST_DLL_LIBRARY_INDEX_HPP
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/library_info.hpp>
+#include <boost/dll/detail/demangling/demangle_symbol.hpp>
+#include <boost/throw_exception.hpp>
+
+#if BOOST_OS_WINDOWS
+#   include <boost/dll/detail/windows/file_identity.hpp>
+#else
+#   include <boost/dll/detail/posix/file_identity.hpp>
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <random>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/// \file boost/dll/library_index.hpp
+/// \brief Contains the boost::dll::library_index class, a persistent cache of the information
+/// extracted from binaries.
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Persistent cache of the library_info::sections() and library_info::symbols() results.
+*
+* Binaries are identified by the absolute path, the file system identifier of the file (inode or file index),
+* the file size and the last modification time. If any of those changes, the binary is parsed again.
+*
+* The index file is memory mapped on construction, so loading it costs no reads or parsing. Only the requested
+* entries are decoded.
+*
+* \b Example:
+* \code
+* boost::dll::library_index index(cache_directory / "plugins.index");
+* for (const auto& plugin : plugins) {
+*     const std::vector<std::string> symbols = index.symbols(plugin); // no binary parsing on a warm start
+*     // ...
+* }
+* index.save(cache_directory / "plugins.index");
+* \endcode
+*
+* \warning Not thread safe.
+*/
+class library_index {
+    /// @cond
+    struct record {
+        boost::dll::detail::file_identity   id;
+        std::vector<std::string>            sections;
+        std::vector<std::string>            symbols;
+        std::vector<std::string>            demangled;
+        bool                                has_demangled;
+    };
+
+    // Index file layout, all the integers are in host byte order:
+    //  header_t | entry_t[entries_count] sorted by path | strings.
+    // Lists of names are stored as sequences of `std::uint32_t` size followed by `size` chars.
+    struct header_t {
+        char            magic[8];
+        std::uint32_t   byte_order;
+        std::uint32_t   version;
+        std::uint64_t   entries_count;
+    };
+
+    struct list_t {
+        std::uint64_t   offset;
+        std::uint64_t   count;
+    };
+
+    struct entry_t {
+        std::uint64_t   path_offset;
+        std::uint64_t   path_size;
+        std::uint64_t   inode;
+        std::uint64_t   size;
+        std::int64_t    mtime_ns;
+        std::uint64_t   has_demangled;
+        list_t          sections;
+        list_t          symbols;
+        list_t          demangled;
+    };
+
+    static constexpr std::uint32_t byte_order_mark = 0x01020304;
+    static constexpr std::uint32_t format_version = 1;
+
+    static const char* magic() noexcept {
+        return "BDLLIDX"; // 8 bytes with the terminating zero
+    }
+
+    boost::dll::detail::mapped_file     mapping_;
+    std::uint64_t                       entries_count_ = 0;
+    std::map<std::string, record>       records_;
+
+    static std::string key(const boost::dll::fs::path& library_path) {
+        return boost::dll::fs::absolute(library_path).lexically_normal().string();
+    }
+
+    entry_t entry_at(std::uint64_t i) const noexcept {
+        entry_t e;
+        std::memcpy(&e, mapping_.data() + sizeof(header_t) + i * sizeof(entry_t), sizeof(entry_t));
+        return e;
+    }
+
+    bool in_range(std::uint64_t offset, std::uint64_t size) const noexcept {
+        return offset <= mapping_.size() && size <= mapping_.size() - offset;
+    }
+
+    bool entry_path(const entry_t& e, boost::core::string_view& path) const noexcept {
+        if (!in_range(e.path_offset, e.path_size)) {
+            return false;
+        }
+        path = boost::core::string_view(mapping_.data() + e.path_offset, static_cast<std::size_t>(e.path_size));
+        return true;
+    }
+
+    bool read_list(const list_t& l, std::vector<std::string>& out) const {
+        out.clear();
+        std::uint64_t offset = l.offset;
+        for (std::uint64_t i = 0; i < l.count; ++i) {
+            std::uint32_t size;
+            if (!in_range(offset, sizeof(size))) {
+                return false;
+            }
+            std::memcpy(&size, mapping_.data() + offset, sizeof(size));
+            offset += sizeof(size);
+
+            if (!in_range(offset, size)) {
+                return false;
+            }
+            out.emplace_back(mapping_.data() + offset, size);
+            offset += size;
+        }
+        return true;
+    }
+
+    bool read_record(const entry_t& e, record& r) const {
+        r.id = boost::dll::detail::file_identity{e.inode, e.size, e.mtime_ns};
+        r.has_demangled = !!e.has_demangled;
+        r.demangled.clear();
+
+        // Each symbol must have its demangled name
+        return read_list(e.sections, r.sections)
+            && read_list(e.symbols, r.symbols)
+            && (!r.has_demangled || (read_list(e.demangled, r.demangled) && r.demangled.size() == r.symbols.size()));
+    }
+
+    // Binary search over the entries sorted by path
+    bool find_entry(const std::string& k, entry_t& e) const noexcept {
+        std::uint64_t first = 0;
+        std::uint64_t last = entries_count_;
+        while (first < last) {
+            const std::uint64_t middle = first + (last - first) / 2;
+            e = entry_at(middle);
+
+            boost::core::string_view path;
+            if (!entry_path(e, path)) {
+                return false;
+            }
+
+            const int cmp = path.compare(k);
+            if (cmp == 0) {
+                return true;
+            } else if (cmp < 0) {
+                first = middle + 1;
+            } else {
+                last = middle;
+            }
+        }
+
+        return false;
+    }
+
+    static void demangle(record& r) {
+        r.demangled.clear();
+        r.demangled.reserve(r.symbols.size());
+        for (const std::string& name : r.symbols) {
+            std::string dm = boost::dll::detail::demangle_symbol(name);
+            r.demangled.push_back(dm.empty() ? name : std::move(dm));
+        }
+        r.has_demangled = true;
+    }
+
+    const record& get(const boost::dll::fs::path& library_path, bool with_demangled) {
+        std::error_code ec;
+        const boost::dll::detail::file_identity id = boost::dll::detail::get_file_identity(library_path, ec);
+        if (ec) {
+            boost::throw_exception(boost::dll::fs::system_error(
+                ec, "boost::dll::library_index failed to get the file identity"
+            ));
+        }
+
+        const std::string k = key(library_path);
+        auto it = records_.find(k);
+        if (it == records_.end() || !(it->second.id == id)) {
+            record r;
+            entry_t e;
+            if (!find_entry(k, e) || !read_record(e, r) || !(r.id == id)) {
+                boost::dll::library_info info(library_path, boost::dll::library_info::read_mode::memory_mapped);
+                r.id = id;
+                r.sections = info.sections();
+                r.symbols = info.symbols();
+                r.demangled.clear();
+                r.has_demangled = false;
+            }
+            record& slot = records_[k];
+            slot = std::move(r);
+            it = records_.find(k);
+        }
+
+        if (with_demangled && !it->second.has_demangled) {
+            demangle(it->second);
+        }
+
+        return it->second;
+    }
+
+    static void append(std::string& out, const void* data, std::size_t size) {
+        out.append(static_cast<const char*>(data), size);
+    }
+
+    static list_t append_list(std::string& out, const std::vector<std::string>& names) {
+        const list_t l{out.size(), names.size()};
+        for (const std::string& name : names) {
+            const std::uint32_t size = static_cast<std::uint32_t>(name.size());
+            append(out, &size, sizeof(size));
+            out += name;
+        }
+        return l;
+    }
+
+    // Concurrent writers of the same index must not share the temporary file
+    static boost::dll::fs::path temporary_path(const boost::dll::fs::path& index_path) {
+        std::random_device rd;
+        std::uint64_t suffix = (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+        suffix ^= static_cast<std::uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+        suffix ^= static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+
+        static const char digits[] = "0123456789abcdef";
+        std::string name = ".tmp.";
+        for (int i = 0; i < 16; ++i, suffix >>= 4) {
+            name += digits[suffix & 0xF];
+        }
+
+        boost::dll::fs::path tmp_path = index_path;
+        tmp_path += name;
+        return tmp_path;
+    }
+    /// @endcond
+
+public:
+    /*!
+    * Creates an empty index.
+    * \throws Nothing.
+    */
+    library_index() = default;
+
+    library_index(const library_index&) = delete;
+    library_index& operator=(const library_index&) = delete;
+
+    /*!
+    * Maps the index file. Missing, corrupted or incompatible index files are ignored.
+    * \param index_path Path to the index file previously written by save().
+    * \throws std::bad_alloc.
+    */
+    explicit library_index(const boost::dll::fs::path& index_path) {
+        std::error_code ec;
+        if (!mapping_.open(index_path, ec) || mapping_.size() < sizeof(header_t)) {
+            mapping_.close();
+            return;
+        }
+
+        header_t h;
+        std::memcpy(&h, mapping_.data(), sizeof(h));
+        if (std::memcmp(h.magic, magic(), sizeof(h.magic)) != 0 || h.byte_order != byte_order_mark
+            || h.version != format_version
+            || h.entries_count > (mapping_.size() - sizeof(header_t)) / sizeof(entry_t))
+        {
+            mapping_.close();
+            return;
+        }
+
+        entries_count_ = h.entries_count;
+    }
+
+    /*!
+    * Same as `library_info(library_path).sections()`, but uses the cached result if the binary was not modified.
+    * \param library_path Path to the binary file.
+    * \throws std::exception based exceptions.
+    */
+    std::vector<std::string> sections(const boost::dll::fs::path& library_path) {
+        return get(library_path, false).sections;
+    }
+
+    /*!
+    * Same as `library_info(library_path).symbols()`, but uses the cached result if the binary was not modified.
+    * \param library_path Path to the binary file.
+    * \throws std::exception based exceptions.
+    */
+    std::vector<std::string> symbols(const boost::dll::fs::path& library_path) {
+        return get(library_path, false).symbols;
+    }
+
+    /*!
+    * \param library_path Path to the binary file.
+    * \return Pairs of mangled and demangled names for each of the `symbols(library_path)`. If the symbol
+    * could not be demangled, the demangled name is the same as the mangled one.
+    * \throws std::exception based exceptions.
+    */
+    std::vector<std::pair<std::string, std::string>> demangled_symbols(const boost::dll::fs::path& library_path) {
+        const record& r = get(library_path, true);
+
+        std::vector<std::pair<std::string, std::string>> ret;
+        ret.reserve(r.symbols.size());
+        for (std::size_t i = 0; i < r.symbols.size(); ++i) {
+            ret.emplace_back(r.symbols[i], r.demangled[i]);
+        }
+        return ret;
+    }
+
+    /*!
+    * Writes all the entries, including the not requested entries from the mapped index file, to the `index_path`.
+    * The file is written to a uniquely named temporary file in the same directory first and then renamed, so
+    * the concurrent readers see either the old or the new index and the concurrent writers do not mix their output.
+    * \param index_path Path to the index file.
+    * \param ec Variable that will be set to the result of the operation.
+    * \throws std::bad_alloc.
+    */
+    void save(const boost::dll::fs::path& index_path, std::error_code& ec) {
+        ec.clear();
+
+        // Decoding all the entries to release the mapping of a possibly overwritten file
+        record r;
+        for (std::uint64_t i = 0; i < entries_count_; ++i) {
+            const entry_t e = entry_at(i);
+            boost::core::string_view path;
+            if (entry_path(e, path) && read_record(e, r)) {
+                records_.emplace(std::string(path.data(), path.size()), std::move(r));
+            }
+        }
+        entries_count_ = 0;
+        mapping_.close();
+
+        std::string strings;
+        std::vector<entry_t> entries;
+        entries.reserve(records_.size());
+        const std::uint64_t strings_offset = sizeof(header_t) + records_.size() * sizeof(entry_t);
+        for (const auto& v : records_) {
+            entry_t e;
+            std::memset(&e, 0, sizeof(e));
+
+            e.path_offset = strings_offset + strings.size();
+            e.path_size = v.first.size();
+            strings += v.first;
+
+            e.inode = v.second.id.inode;
+            e.size = v.second.id.size;
+            e.mtime_ns = v.second.id.mtime_ns;
+            e.has_demangled = v.second.has_demangled;
+
+            e.sections = append_list(strings, v.second.sections);
+            e.sections.offset += strings_offset;
+            e.symbols = append_list(strings, v.second.symbols);
+            e.symbols.offset += strings_offset;
+            if (v.second.has_demangled) {
+                e.demangled = append_list(strings, v.second.demangled);
+                e.demangled.offset += strings_offset;
+            }
+            entries.push_back(e);
+        }
+
+        header_t h;
+        std::memcpy(h.magic, magic(), sizeof(h.magic));
+        h.byte_order = byte_order_mark;
+        h.version = format_version;
+        h.entries_count = entries.size();
+
+        const boost::dll::fs::path tmp_path = temporary_path(index_path);
+        boost::dll::fs::error_code fs_ec;
+        {
+            std::ofstream ofs(tmp_path.string(), std::ios_base::binary | std::ios_base::trunc);
+            ofs.write(reinterpret_cast<const char*>(&h), sizeof(h));
+            if (!entries.empty()) {
+                ofs.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(entry_t)));
+            }
+            ofs.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+            ofs.close();
+            if (!ofs) {
+                ec = std::make_error_code(std::errc::io_error);
+                boost::dll::fs::remove(tmp_path, fs_ec);
+                return;
+            }
+        }
+
+        boost::dll::fs::rename(tmp_path, index_path, fs_ec);
+        if (fs_ec) {
+            ec = fs_ec;
+            boost::dll::fs::remove(tmp_path, fs_ec);
+        }
+    }
+
+    /*!
+    * Same as save(const boost::dll::fs::path&, std::error_code&), but throws on error.
+    * \param index_path Path to the index file.
+    * \throws \forcedlinkfs{system_error}, std::bad_alloc.
+    */
+    void save(const boost::dll::fs::path& index_path) {
+        std::error_code ec;
+        save(index_path, ec);
+        if (ec) {
+            boost::throw_exception(boost::dll::fs::system_error(ec, "boost::dll::library_index::save() failed"));
+        }
+    }
+};
+
+}} // namespace boost::dll
+
+#endif // BOOST_DLL_LIBRARY_INDEX_HPP
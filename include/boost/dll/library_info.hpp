@@ -16,29 +16,166 @@
 #include <boost/throw_exception.hpp>
 
 #include <fstream>
+#include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
+#include <boost/core/detail/string_view.hpp>
+
+#include <boost/dll/binary_reader.hpp>
+#include <boost/dll/symbol_info.hpp>
+#include <boost/dll/detail/binary_source.hpp>
+#include <boost/dll/detail/stream_reader.hpp>
 #include <boost/dll/detail/pe_info.hpp>
 #include <boost/dll/detail/elf_info.hpp>
 #include <boost/dll/detail/macho_info.hpp>
 
+#if BOOST_OS_WINDOWS
+#   include <boost/dll/detail/windows/mapped_file.hpp>
+#else
+#   include <boost/dll/detail/posix/mapped_file.hpp>
+#endif
+
 #ifdef BOOST_HAS_PRAGMA_ONCE
 # pragma once
 #endif
 
 /// \file boost/dll/library_info.hpp
-/// \brief Contains only the boost::dll::library_info class that is capable of
+/// \brief Contains the boost::dll::library_info class that is capable of
 /// extracting different information from binaries.
 
 namespace boost { namespace dll {
 
+/// @cond
+namespace detail {
+
+// Adapts `void visitor(value)` and `bool visitor(value)` to the `bool f(value)` form used by the parsers.
+template <class Visitor>
+struct visitor_adaptor {
+    Visitor& visitor;
+
+    template <class T>
+    bool call(const T& value, std::true_type /* returns void */) const {
+        visitor(value);
+        return true;
+    }
+
+    template <class T>
+    bool call(const T& value, std::false_type /* returns void */) const {
+        return static_cast<bool>(visitor(value));
+    }
+
+    template <class T>
+    bool operator()(const T& value) const {
+        return call(value, std::is_void<decltype(visitor(value))>());
+    }
+};
+
+} // namespace detail
+/// @endcond
+
+class library_info;
+
+/*!
+* \brief Range of names that owns the memory of all the names.
+*
+* Names are stored one after another in a single buffer, so building and traversing
+* the range requires no per-name memory allocations. Instances are move-only, the
+* `boost::core::string_view` elements remain valid until the range is destroyed.
+*/
+class names_view {
+    std::vector<char> storage_;
+    std::vector<boost::core::string_view> names_;
+
+    /// @cond
+    friend class boost::dll::library_info;
+
+    void push_back(boost::core::string_view name) {
+        storage_.insert(storage_.end(), name.begin(), name.end());
+        names_.push_back(name);
+    }
+
+    // Makes the views point to the `storage_` instead of the original names.
+    void finish() noexcept {
+        const char* p = storage_.data();
+        for (boost::core::string_view& name : names_) {
+            name = boost::core::string_view(p, name.size());
+            p += name.size();
+        }
+    }
+    /// @endcond
+
+public:
+    using value_type = boost::core::string_view;
+    using const_iterator = std::vector<boost::core::string_view>::const_iterator;
+    using iterator = const_iterator;
+    using size_type = std::size_t;
+
+    names_view() = default;
+    names_view(names_view&&) = default;
+    names_view& operator=(names_view&&) = default;
+    names_view(const names_view&) = delete;
+    names_view& operator=(const names_view&) = delete;
+
+    const_iterator begin() const noexcept { return names_.begin(); }
+    const_iterator end() const noexcept { return names_.end(); }
+    size_type size() const noexcept { return names_.size(); }
+    bool empty() const noexcept { return names_.empty(); }
+    boost::core::string_view operator[](size_type i) const noexcept { return names_[i]; }
+};
+
 /*!
 * \brief Class that is capable of extracting different information from a library or binary file.
 * Currently understands ELF, MACH-O and PE formats on all the platforms.
 */
 class library_info: private boost::noncopyable {
+public:
+    /*!
+    * \brief Specifies the way the binary file is accessed.
+    */
+    enum class read_mode {
+        /// Read the file using `std::ifstream`.
+        stream,
+
+        /// Map the whole file into memory and parse headers, section tables and string tables
+        /// right from the mapping without copying them. Falls back to `read_mode::stream` if the file
+        /// could not be mapped.
+        ///
+        /// \warning The file must not be modified while the library_info instance exists.
+        memory_mapped
+    };
+
+    /*!
+    * \brief Specifies the symbols that are searched by has_symbol().
+    */
+    enum class symbol_search {
+        /// Symbols that are exported for the dynamic linking. For ELF only the ".gnu.hash" or ".hash" sections
+        /// are used if they exist, so the missing symbols are reported without reading the symbols table.
+        exported,
+
+        /// All the symbols that are returned by symbols(). For ELF binaries with the ".symtab" section that
+        /// includes the global symbols of executables that are not exported, and the missing symbols are
+        /// reported only after the linear search over the whole ".symtab" section.
+        all
+    };
+
+    /*!
+    * \brief Format of the binary file.
+    */
+    enum class binary_format {
+        elf32,      ///< 32 bit ELF
+        elf64,      ///< 64 bit ELF
+        pe32,       ///< 32 bit PE
+        pe64,       ///< 64 bit PE
+        macho32,    ///< 32 bit Mach-O
+        macho64     ///< 64 bit Mach-O
+    };
+
 private:
-    std::ifstream f_;
+    boost::dll::detail::stream_reader stream_;
+    boost::dll::detail::mapped_file mapping_;
+    boost::dll::detail::binary_source src_;
 
     enum {
         fmt_elf_info32,
@@ -80,27 +217,27 @@ private:
     }
 
     void init(bool throw_if_not_native) {
-        if (boost::dll::detail::elf_info32::parsing_supported(f_)) {
+        if (boost::dll::detail::elf_info32::parsing_supported(src_)) {
             if (throw_if_not_native) { throw_if_in_windows(); throw_if_in_macos(); }
 
             fmt_ = fmt_elf_info32;
-        } else if (boost::dll::detail::elf_info64::parsing_supported(f_)) {
+        } else if (boost::dll::detail::elf_info64::parsing_supported(src_)) {
             if (throw_if_not_native) { throw_if_in_windows(); throw_if_in_macos(); throw_if_in_32bit(); }
 
             fmt_ = fmt_elf_info64;
-        } else if (boost::dll::detail::pe_info32::parsing_supported(f_)) {
+        } else if (boost::dll::detail::pe_info32::parsing_supported(src_)) {
             if (throw_if_not_native) { throw_if_in_linux(); throw_if_in_macos(); }
 
             fmt_ = fmt_pe_info32;
-        } else if (boost::dll::detail::pe_info64::parsing_supported(f_)) {
+        } else if (boost::dll::detail::pe_info64::parsing_supported(src_)) {
             if (throw_if_not_native) { throw_if_in_linux(); throw_if_in_macos(); throw_if_in_32bit(); }
 
             fmt_ = fmt_pe_info64;
-        } else if (boost::dll::detail::macho_info32::parsing_supported(f_)) {
+        } else if (boost::dll::detail::macho_info32::parsing_supported(src_)) {
             if (throw_if_not_native) { throw_if_in_linux(); throw_if_in_windows(); }
 
             fmt_ = fmt_macho_info32;
-        } else if (boost::dll::detail::macho_info64::parsing_supported(f_)) {
+        } else if (boost::dll::detail::macho_info64::parsing_supported(src_)) {
             if (throw_if_not_native) { throw_if_in_linux(); throw_if_in_windows(); throw_if_in_32bit(); }
 
             fmt_ = fmt_macho_info64;
@@ -108,6 +245,62 @@ private:
             boost::throw_exception(std::runtime_error("Unsupported binary format"));
         }
     }
+
+    template <class F>
+    bool for_each_section_impl(F f) {
+        switch (fmt_) {
+        case fmt_elf_info32:   return boost::dll::detail::elf_info32::for_each_section(src_, f);
+        case fmt_elf_info64:   return boost::dll::detail::elf_info64::for_each_section(src_, f);
+        case fmt_pe_info32:    return boost::dll::detail::pe_info32::for_each_section(src_, f);
+        case fmt_pe_info64:    return boost::dll::detail::pe_info64::for_each_section(src_, f);
+        case fmt_macho_info32: return boost::dll::detail::macho_info32::for_each_section(src_, f);
+        case fmt_macho_info64: return boost::dll::detail::macho_info64::for_each_section(src_, f);
+        };
+        BOOST_ASSERT(false);
+        BOOST_UNREACHABLE_RETURN(true)
+    }
+
+    template <class F>
+    bool for_each_symbol_impl(F f) {
+        switch (fmt_) {
+        case fmt_elf_info32:   return boost::dll::detail::elf_info32::for_each_symbol(src_, f);
+        case fmt_elf_info64:   return boost::dll::detail::elf_info64::for_each_symbol(src_, f);
+        case fmt_pe_info32:    return boost::dll::detail::pe_info32::for_each_symbol(src_, f);
+        case fmt_pe_info64:    return boost::dll::detail::pe_info64::for_each_symbol(src_, f);
+        case fmt_macho_info32: return boost::dll::detail::macho_info32::for_each_symbol(src_, f);
+        case fmt_macho_info64: return boost::dll::detail::macho_info64::for_each_symbol(src_, f);
+        };
+        BOOST_ASSERT(false);
+        BOOST_UNREACHABLE_RETURN(true)
+    }
+
+    template <class F>
+    bool for_each_symbol_info_impl(F f) {
+        switch (fmt_) {
+        case fmt_elf_info32:   return boost::dll::detail::elf_info32::for_each_symbol_info(src_, f);
+        case fmt_elf_info64:   return boost::dll::detail::elf_info64::for_each_symbol_info(src_, f);
+        case fmt_pe_info32:    return boost::dll::detail::pe_info32::for_each_symbol_info(src_, f);
+        case fmt_pe_info64:    return boost::dll::detail::pe_info64::for_each_symbol_info(src_, f);
+        case fmt_macho_info32: return boost::dll::detail::macho_info32::for_each_symbol_info(src_, f);
+        case fmt_macho_info64: return boost::dll::detail::macho_info64::for_each_symbol_info(src_, f);
+        };
+        BOOST_ASSERT(false);
+        BOOST_UNREACHABLE_RETURN(true)
+    }
+
+    template <class F>
+    bool for_each_symbol_impl(const char* section_name, F f) {
+        switch (fmt_) {
+        case fmt_elf_info32:   return boost::dll::detail::elf_info32::for_each_symbol(src_, section_name, f);
+        case fmt_elf_info64:   return boost::dll::detail::elf_info64::for_each_symbol(src_, section_name, f);
+        case fmt_pe_info32:    return boost::dll::detail::pe_info32::for_each_symbol(src_, section_name, f);
+        case fmt_pe_info64:    return boost::dll::detail::pe_info64::for_each_symbol(src_, section_name, f);
+        case fmt_macho_info32: return boost::dll::detail::macho_info32::for_each_symbol(src_, section_name, f);
+        case fmt_macho_info64: return boost::dll::detail::macho_info64::for_each_symbol(src_, section_name, f);
+        };
+        BOOST_ASSERT(false);
+        BOOST_UNREACHABLE_RETURN(true)
+    }
     /// @endcond
 
 public:
@@ -119,40 +312,87 @@ public:
     * \throws std::exception based exceptions.
     */
     explicit library_info(const boost::dll::fs::path& library_path, bool throw_if_not_native_format = true)
-        : f_(
-        #ifdef BOOST_DLL_USE_STD_FS
-            library_path,
-        //  Copied from boost/filesystem/fstream.hpp
-        #elif defined(BOOST_WINDOWS_API)  && (!defined(_CPPLIB_VER) || _CPPLIB_VER < 405 || defined(_STLPORT_VERSION))
-            // !Dinkumware || early Dinkumware || STLPort masquerading as Dinkumware
-            library_path.string().c_str(),  // use narrow, since wide not available
-        #else  // use the native c_str, which will be narrow on POSIX, wide on Windows
-            library_path.c_str(),
-        #endif
-            std::ios_base::in | std::ios_base::binary
-        )
+        : library_info(library_path, read_mode::stream, throw_if_not_native_format)
+    {}
+
+    /*!
+    * Opens file with specified path and prepares for information extraction.
+    * \param library_path Path to the binary file from which the info must be extracted.
+    * \param mode The way to access the file.
+    * \param throw_if_not_native_format Throw an exception if this file format is not
+    * supported by OS.
+    * \throws std::exception based exceptions.
+    */
+    library_info(const boost::dll::fs::path& library_path, read_mode mode, bool throw_if_not_native_format = true) {
+        std::error_code ec;
+        if (mode == read_mode::memory_mapped && mapping_.open(library_path, ec)) {
+            src_ = boost::dll::detail::binary_source(mapping_.data(), mapping_.size());
+        } else {
+            stream_.open(library_path);
+            src_ = boost::dll::detail::binary_source(stream_);
+        }
+
+        init(throw_if_not_native_format);
+    }
+
+    /*!
+    * Prepares for information extraction from the binary that is already in memory.
+    * The memory is not copied and must outlive the library_info instance.
+    * \param data Pointer to the first byte of the binary.
+    * \param size Size of the binary in bytes.
+    * \param throw_if_not_native_format Throw an exception if this file format is not
+    * supported by OS.
+    * \throws std::exception based exceptions.
+    */
+    library_info(const unsigned char* data, std::size_t size, bool throw_if_not_native_format = true)
+        : src_(reinterpret_cast<const char*>(data), size)
     {
-        f_.exceptions(
-            std::ios_base::failbit
-            | std::ifstream::badbit
-            | std::ifstream::eofbit
-        );
+        init(throw_if_not_native_format);
+    }
 
+    /*!
+    * Prepares for information extraction from the binary provided by a user defined reader.
+    * The reader must outlive the library_info instance.
+    * \param reader Reader of the binary.
+    * \param throw_if_not_native_format Throw an exception if this file format is not
+    * supported by OS.
+    * \throws std::exception based exceptions.
+    */
+    explicit library_info(boost::dll::binary_reader& reader, bool throw_if_not_native_format = true)
+        : src_(reader)
+    {
         init(throw_if_not_native_format);
     }
 
+    /*!
+    * \return Format of the binary file.
+    * \throws Nothing.
+    */
+    binary_format format() const noexcept {
+        switch (fmt_) {
+        case fmt_elf_info32:   return binary_format::elf32;
+        case fmt_elf_info64:   return binary_format::elf64;
+        case fmt_pe_info32:    return binary_format::pe32;
+        case fmt_pe_info64:    return binary_format::pe64;
+        case fmt_macho_info32: return binary_format::macho32;
+        case fmt_macho_info64: return binary_format::macho64;
+        };
+        BOOST_ASSERT(false);
+        BOOST_UNREACHABLE_RETURN(binary_format::elf64)
+    }
+
     /*!
     * \return List of sections that exist in binary file.
     * \throws std::exception based exceptions.
     */
     std::vector<std::string> sections() {
         switch (fmt_) {
-        case fmt_elf_info32:   return boost::dll::detail::elf_info32::sections(f_);
-        case fmt_elf_info64:   return boost::dll::detail::elf_info64::sections(f_);
-        case fmt_pe_info32:    return boost::dll::detail::pe_info32::sections(f_);
-        case fmt_pe_info64:    return boost::dll::detail::pe_info64::sections(f_);
-        case fmt_macho_info32: return boost::dll::detail::macho_info32::sections(f_);
-        case fmt_macho_info64: return boost::dll::detail::macho_info64::sections(f_);
+        case fmt_elf_info32:   return boost::dll::detail::elf_info32::sections(src_);
+        case fmt_elf_info64:   return boost::dll::detail::elf_info64::sections(src_);
+        case fmt_pe_info32:    return boost::dll::detail::pe_info32::sections(src_);
+        case fmt_pe_info64:    return boost::dll::detail::pe_info64::sections(src_);
+        case fmt_macho_info32: return boost::dll::detail::macho_info32::sections(src_);
+        case fmt_macho_info64: return boost::dll::detail::macho_info64::sections(src_);
         };
         BOOST_ASSERT(false);
         BOOST_UNREACHABLE_RETURN(std::vector<std::string>())
@@ -164,12 +404,12 @@ public:
     */
     std::vector<std::string> symbols() {
         switch (fmt_) {
-        case fmt_elf_info32:   return boost::dll::detail::elf_info32::symbols(f_);
-        case fmt_elf_info64:   return boost::dll::detail::elf_info64::symbols(f_);
-        case fmt_pe_info32:    return boost::dll::detail::pe_info32::symbols(f_);
-        case fmt_pe_info64:    return boost::dll::detail::pe_info64::symbols(f_);
-        case fmt_macho_info32: return boost::dll::detail::macho_info32::symbols(f_);
-        case fmt_macho_info64: return boost::dll::detail::macho_info64::symbols(f_);
+        case fmt_elf_info32:   return boost::dll::detail::elf_info32::symbols(src_);
+        case fmt_elf_info64:   return boost::dll::detail::elf_info64::symbols(src_);
+        case fmt_pe_info32:    return boost::dll::detail::pe_info32::symbols(src_);
+        case fmt_pe_info64:    return boost::dll::detail::pe_info64::symbols(src_);
+        case fmt_macho_info32: return boost::dll::detail::macho_info32::symbols(src_);
+        case fmt_macho_info64: return boost::dll::detail::macho_info64::symbols(src_);
         };
         BOOST_ASSERT(false);
         BOOST_UNREACHABLE_RETURN(std::vector<std::string>())
@@ -182,12 +422,12 @@ public:
     */
     std::vector<std::string> symbols(const char* section_name) {
         switch (fmt_) {
-        case fmt_elf_info32:   return boost::dll::detail::elf_info32::symbols(f_, section_name);
-        case fmt_elf_info64:   return boost::dll::detail::elf_info64::symbols(f_, section_name);
-        case fmt_pe_info32:    return boost::dll::detail::pe_info32::symbols(f_, section_name);
-        case fmt_pe_info64:    return boost::dll::detail::pe_info64::symbols(f_, section_name);
-        case fmt_macho_info32: return boost::dll::detail::macho_info32::symbols(f_, section_name);
-        case fmt_macho_info64: return boost::dll::detail::macho_info64::symbols(f_, section_name);
+        case fmt_elf_info32:   return boost::dll::detail::elf_info32::symbols(src_, section_name);
+        case fmt_elf_info64:   return boost::dll::detail::elf_info64::symbols(src_, section_name);
+        case fmt_pe_info32:    return boost::dll::detail::pe_info32::symbols(src_, section_name);
+        case fmt_pe_info64:    return boost::dll::detail::pe_info64::symbols(src_, section_name);
+        case fmt_macho_info32: return boost::dll::detail::macho_info32::symbols(src_, section_name);
+        case fmt_macho_info64: return boost::dll::detail::macho_info64::symbols(src_, section_name);
         };
         BOOST_ASSERT(false);
         BOOST_UNREACHABLE_RETURN(std::vector<std::string>())
@@ -197,16 +437,202 @@ public:
     //! \overload std::vector<std::string> symbols(const char* section_name)
     std::vector<std::string> symbols(const std::string& section_name) {
         switch (fmt_) {
-        case fmt_elf_info32:   return boost::dll::detail::elf_info32::symbols(f_, section_name.c_str());
-        case fmt_elf_info64:   return boost::dll::detail::elf_info64::symbols(f_, section_name.c_str());
-        case fmt_pe_info32:    return boost::dll::detail::pe_info32::symbols(f_, section_name.c_str());
-        case fmt_pe_info64:    return boost::dll::detail::pe_info64::symbols(f_, section_name.c_str());
-        case fmt_macho_info32: return boost::dll::detail::macho_info32::symbols(f_, section_name.c_str());
-        case fmt_macho_info64: return boost::dll::detail::macho_info64::symbols(f_, section_name.c_str());
+        case fmt_elf_info32:   return boost::dll::detail::elf_info32::symbols(src_, section_name.c_str());
+        case fmt_elf_info64:   return boost::dll::detail::elf_info64::symbols(src_, section_name.c_str());
+        case fmt_pe_info32:    return boost::dll::detail::pe_info32::symbols(src_, section_name.c_str());
+        case fmt_pe_info64:    return boost::dll::detail::pe_info64::symbols(src_, section_name.c_str());
+        case fmt_macho_info32: return boost::dll::detail::macho_info32::symbols(src_, section_name.c_str());
+        case fmt_macho_info64: return boost::dll::detail::macho_info64::symbols(src_, section_name.c_str());
+        };
+        BOOST_ASSERT(false);
+        BOOST_UNREACHABLE_RETURN(std::vector<std::string>())
+    }
+
+    /*!
+    * \return Names of the libraries that are directly required by the binary file, exactly as they are recorded
+    * in it: DT_NEEDED entries for ELF, import directory modules for PE, LC_LOAD_DYLIB commands for Mach-O.
+    * \throws std::exception based exceptions.
+    */
+    std::vector<std::string> dependencies() {
+        switch (fmt_) {
+        case fmt_elf_info32:   return boost::dll::detail::elf_info32::dependencies(src_);
+        case fmt_elf_info64:   return boost::dll::detail::elf_info64::dependencies(src_);
+        case fmt_pe_info32:    return boost::dll::detail::pe_info32::dependencies(src_);
+        case fmt_pe_info64:    return boost::dll::detail::pe_info64::dependencies(src_);
+        case fmt_macho_info32: return boost::dll::detail::macho_info32::dependencies(src_);
+        case fmt_macho_info64: return boost::dll::detail::macho_info64::dependencies(src_);
         };
         BOOST_ASSERT(false);
         BOOST_UNREACHABLE_RETURN(std::vector<std::string>())
     }
+
+    /*!
+    * Same as sections(), but does not allocate memory for each name.
+    * \return Range of boost::core::string_view with names of sections that exist in binary file.
+    * \throws std::exception based exceptions.
+    */
+    names_view sections_view() {
+        names_view ret;
+        for_each_section_impl([&ret](boost::core::string_view name) { ret.push_back(name); return true; });
+        ret.finish();
+        return ret;
+    }
+
+    /*!
+    * Same as symbols(), but does not allocate memory for each name.
+    * \return Range of boost::core::string_view with all the exportable symbols from all the sections that exist in binary file.
+    * \throws std::exception based exceptions.
+    */
+    names_view symbols_view() {
+        names_view ret;
+        for_each_symbol_impl([&ret](boost::core::string_view name) { ret.push_back(name); return true; });
+        ret.finish();
+        return ret;
+    }
+
+    /*!
+    * Same as symbols(const char* section_name), but does not allocate memory for each name.
+    * \param section_name Name of the section from which symbol names must be returned.
+    * \return Range of boost::core::string_view with symbols from the specified section.
+    * \throws std::exception based exceptions.
+    */
+    names_view symbols_view(const char* section_name) {
+        names_view ret;
+        for_each_symbol_impl(section_name, [&ret](boost::core::string_view name) { ret.push_back(name); return true; });
+        ret.finish();
+        return ret;
+    }
+
+    //! \overload names_view symbols_view(const char* section_name)
+    names_view symbols_view(const std::string& section_name) {
+        return symbols_view(section_name.c_str());
+    }
+
+    /*!
+    * Calls `visitor(name)` for each exportable symbol from all the sections that exist in binary file.
+    * No memory is allocated for the names.
+    * \param visitor Callable with `void(boost::core::string_view)` or `bool(boost::core::string_view)` signature.
+    * If it returns `false` the iteration stops. The `name` is valid only during the call.
+    * \throws std::exception based exceptions.
+    */
+    template <class Visitor>
+    void for_each_symbol(Visitor visitor) {
+        for_each_symbol_impl(boost::dll::detail::visitor_adaptor<Visitor>{visitor});
+    }
+
+    /*!
+    * Calls `visitor(name)` for each exportable symbol from the specified section.
+    * No memory is allocated for the names.
+    * \param section_name Name of the section from which symbol names must be visited.
+    * \param visitor Callable with `void(boost::core::string_view)` or `bool(boost::core::string_view)` signature.
+    * If it returns `false` the iteration stops. The `name` is valid only during the call.
+    * \throws std::exception based exceptions.
+    */
+    template <class Visitor>
+    void for_each_symbol(const char* section_name, Visitor visitor) {
+        for_each_symbol_impl(section_name, boost::dll::detail::visitor_adaptor<Visitor>{visitor});
+    }
+
+    //! \overload void for_each_symbol(const char* section_name, Visitor visitor)
+    template <class Visitor>
+    void for_each_symbol(const std::string& section_name, Visitor visitor) {
+        for_each_symbol(section_name.c_str(), std::move(visitor));
+    }
+
+    /*!
+    * Calls `visitor(info)` for each exportable symbol from all the sections that exist in binary file.
+    * The symbols are the same and in the same order as in symbols(), the information is extracted
+    * during the same pass over the symbols table.
+    *
+    * \b Example:
+    * \code
+    * std::uint64_t plugin_data_size = 0;
+    * info.for_each_symbol_info([&plugin_data_size](const boost::dll::symbol_info& s) {
+    *     if (s.type == boost::dll::symbol_type::object) {
+    *         plugin_data_size += s.size;
+    *     }
+    * });
+    * \endcode
+    *
+    * \param visitor Callable with `void(const boost::dll::symbol_info&)` or `bool(const boost::dll::symbol_info&)` signature.
+    * If it returns `false` the iteration stops. The `info.name` is valid only during the call.
+    * \throws std::exception based exceptions.
+    */
+    template <class Visitor>
+    void for_each_symbol_info(Visitor visitor) {
+        for_each_symbol_info_impl(boost::dll::detail::visitor_adaptor<Visitor>{visitor});
+    }
+
+    /*!
+    * Checks that the binary file exports the specified symbol without decoding the whole symbols table if possible.
+    * For ELF uses the ".gnu.hash" or ".hash" sections, for PE uses the binary search over the
+    * sorted export names. Falls back to the linear search otherwise.
+    * \param symbol_name Name of the symbol to look for.
+    * \param search Symbols to search. With symbol_search::all a missing symbol of an ELF binary that has
+    * the ".symtab" section costs a linear search over that section.
+    * \return true if the symbol is exported or, for symbol_search::all, is in the list returned by symbols().
+    * \throws std::exception based exceptions.
+    */
+    bool has_symbol(boost::core::string_view symbol_name, symbol_search search = symbol_search::exported) {
+        const bool search_symtab = (search == symbol_search::all);
+        switch (fmt_) {
+        case fmt_elf_info32:   return boost::dll::detail::elf_info32::has_symbol(src_, symbol_name, search_symtab);
+        case fmt_elf_info64:   return boost::dll::detail::elf_info64::has_symbol(src_, symbol_name, search_symtab);
+        case fmt_pe_info32:    return boost::dll::detail::pe_info32::has_symbol(src_, symbol_name);
+        case fmt_pe_info64:    return boost::dll::detail::pe_info64::has_symbol(src_, symbol_name);
+        case fmt_macho_info32: return boost::dll::detail::macho_info32::has_symbol(src_, symbol_name);
+        case fmt_macho_info64: return boost::dll::detail::macho_info64::has_symbol(src_, symbol_name);
+        };
+        BOOST_ASSERT(false);
+        BOOST_UNREACHABLE_RETURN(false)
+    }
+
+    /*!
+    * Searches for the first exportable symbol that satisfies the predicate. Stops reading
+    * the symbols table right after the match.
+    * \param pred Callable with `bool(boost::core::string_view)` signature.
+    * \return Name of the first symbol for which `pred` returned true or an empty string if there is no such symbol.
+    * \throws std::exception based exceptions.
+    */
+    template <class Predicate>
+    std::string find_symbol(Predicate pred) {
+        std::string ret;
+        for_each_symbol_impl([&ret, &pred](boost::core::string_view name) {
+            if (!pred(name)) {
+                return true;
+            }
+            ret.assign(name.data(), name.size());
+            return false;
+        });
+        return ret;
+    }
+
+    /*!
+    * Searches for the first exportable symbol from the specified section that satisfies the predicate.
+    * Stops reading the symbols table right after the match.
+    * \param section_name Name of the section from which symbol must be found.
+    * \param pred Callable with `bool(boost::core::string_view)` signature.
+    * \return Name of the first symbol for which `pred` returned true or an empty string if there is no such symbol.
+    * \throws std::exception based exceptions.
+    */
+    template <class Predicate>
+    std::string find_symbol(const char* section_name, Predicate pred) {
+        std::string ret;
+        for_each_symbol_impl(section_name, [&ret, &pred](boost::core::string_view name) {
+            if (!pred(name)) {
+                return true;
+            }
+            ret.assign(name.data(), name.size());
+            return false;
+        });
+        return ret;
+    }
+
+    //! \overload std::string find_symbol(const char* section_name, Predicate pred)
+    template <class Predicate>
+    std::string find_symbol(const std::string& section_name, Predicate pred) {
+        return find_symbol(section_name.c_str(), std::move(pred));
+    }
 };
 
 }} // namespace boost::dll
@@ -0,0 +1,293 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_LIBRARY_REGISTRY_HPP
+#define BOOST_DLL_LIBRARY_REGISTRY_HPP
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/shared_library.hpp>
+#include <boost/dll/detail/system_error.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/// \file boost/dll/library_registry.hpp
+/// \brief Contains the boost::dll::library_registry class, an opt-in cache of loaded libraries.
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Cache of the libraries loaded through it.
+*
+* The first load of a path performs the usual shared_library loading, including the path decoration,
+* the dynamic loader search and the checks for the program itself. The registry is not locked during that loading,
+* so the libraries could be loaded and looked up concurrently. Subsequent loads of the same path with the same
+* mode are a path canonicalization, a hash lookup and an atomic increment of the reference count.
+*
+* Paths are made absolute relative to the current directory and canonical if the file exists, so different
+* spellings of the same path share a cache entry without loading the library again. File names without a parent
+* path that are loaded with load_mode::search_system_folders are used as is. Libraries that are loaded via paths
+* that are not equivalent, but resolve to the same DLL/DSO, also share a single cache entry.
+*
+* Registry keeps a reference to each library it loaded, so the libraries are not unloaded until release_unused()
+* or clear() is called, or the registry is destroyed.
+*
+* \b Example:
+* \code
+* boost::dll::shared_library lib = boost::dll::library_registry::global().load("plugins/libcompression.so");
+* \endcode
+*
+* All the methods are thread safe.
+*/
+class library_registry {
+public:
+    /*!
+    * \brief Diagnostic information about a library in the registry.
+    */
+    struct library_entry {
+        /// Full path to the loaded library, same as shared_library::location().
+        boost::dll::fs::path location;
+
+        /// Paths that were used to load the library through the registry.
+        std::vector<boost::dll::fs::path> requested_paths;
+
+        /// Native handle of the library.
+        shared_library::native_handle_t native;
+
+        /// Number of shared_library instances that reference the library, not counting the registry itself.
+        std::size_t use_count;
+    };
+
+private:
+    /// @cond
+    struct record {
+        boost::dll::shared_library          lib;
+        boost::dll::fs::path                location;
+        std::vector<boost::dll::fs::path>   requested_paths;
+    };
+
+    struct key {
+        boost::dll::fs::path::string_type   path;
+        load_mode::type                     mode;
+
+        bool operator==(const key& other) const noexcept {
+            return mode == other.mode && path == other.path;
+        }
+    };
+
+    struct key_hash {
+        std::size_t operator()(const key& k) const noexcept {
+            return std::hash<boost::dll::fs::path::string_type>()(k.path) ^ static_cast<std::size_t>(k.mode);
+        }
+    };
+
+    // Unloading a library runs its termination code that may use the registry
+    mutable std::recursive_mutex                    mutex_;
+    std::list<record>                               records_;
+    std::unordered_map<key, record*, key_hash>      index_;
+
+    // Relative paths are resolved against the current directory on each load, so the key is made absolute and
+    // canonical once. Bare file names that are searched in the system folders do not depend on the current directory.
+    static key make_key(const boost::dll::fs::path& lib_path, load_mode::type mode) {
+        if (!!(mode & load_mode::search_system_folders) && !lib_path.has_parent_path()) {
+            return key{lib_path.native(), mode};
+        }
+
+        boost::dll::fs::error_code ec;
+        boost::dll::fs::path p = lib_path;
+        if (!p.is_absolute()) {
+            p = boost::dll::fs::current_path(ec);
+            if (ec) {
+                return key{lib_path.native(), mode};
+            }
+            p /= lib_path;
+        }
+
+        boost::dll::fs::path canonical = boost::dll::fs::canonical(p, ec);
+        if (ec) {
+            // File does not exist, for example the path is not decorated yet
+            canonical = p.lexically_normal();
+        }
+        return key{canonical.native(), mode};
+    }
+
+    static std::size_t use_count(const boost::dll::shared_library& lib) noexcept {
+        return static_cast<const boost::dll::detail::shared_library_impl&>(lib).use_count();
+    }
+
+    void erase_index(const record& r) noexcept {
+        for (auto it = index_.begin(); it != index_.end();) {
+            if (it->second == &r) {
+                it = index_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    /// @endcond
+
+public:
+    /*!
+    * Creates an empty registry.
+    * \throws Nothing.
+    */
+    library_registry() = default;
+
+    library_registry(const library_registry&) = delete;
+    library_registry& operator=(const library_registry&) = delete;
+
+    /*!
+    * \return The process wide instance of the registry.
+    * \throws Nothing.
+    */
+    static library_registry& global() noexcept {
+        static library_registry registry;
+        return registry;
+    }
+
+    /*!
+    * Loads the library or returns the already loaded one.
+    *
+    * \param lib_path Library file name, same as for shared_library::load().
+    * \param mode A mode that will be used on library load.
+    * \param ec Variable that will be set to the result of the operation.
+    * \return Loaded library or an empty shared_library on error.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    shared_library load(const boost::dll::fs::path& lib_path, load_mode::type mode, std::error_code& ec) {
+        ec.clear();
+
+        key k = make_key(lib_path, mode);
+        {
+            std::lock_guard<std::recursive_mutex> lock(mutex_);
+            const auto it = index_.find(k);
+            if (it != index_.end()) {
+                return it->second->lib;
+            }
+        }
+
+        // Loading runs the initialization code of the library, other threads must not wait for it
+        boost::dll::shared_library lib(lib_path, mode, ec);
+        if (ec) {
+            return boost::dll::shared_library();
+        }
+
+        boost::dll::fs::path location = lib.location(ec);
+        if (ec) {
+            return boost::dll::shared_library();
+        }
+
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+        // Other thread could load the same path while the registry was not locked
+        const auto it = index_.find(k);
+        if (it != index_.end()) {
+            return it->second->lib;
+        }
+
+        // The same library could be already loaded through a different path
+        record* r = nullptr;
+        for (record& existing : records_) {
+            if (existing.lib == lib) {
+                r = &existing;
+                break;
+            }
+        }
+
+        if (!r) {
+            records_.push_back(record{std::move(lib), std::move(location), {}});
+            r = &records_.back();
+        }
+
+        r->requested_paths.push_back(lib_path);
+        index_.emplace(std::move(k), r);
+        return r->lib;
+    }
+
+    //! \overload shared_library load(const boost::dll::fs::path& lib_path, load_mode::type mode, std::error_code& ec)
+    shared_library load(const boost::dll::fs::path& lib_path, std::error_code& ec, load_mode::type mode = load_mode::default_mode) {
+        return load(lib_path, mode, ec);
+    }
+
+    /*!
+    * Loads the library or returns the already loaded one.
+    *
+    * \param lib_path Library file name, same as for shared_library::load().
+    * \param mode A mode that will be used on library load.
+    * \return Loaded library.
+    * \throws \forcedlinkfs{system_error}, std::bad_alloc in case of insufficient memory.
+    */
+    shared_library load(const boost::dll::fs::path& lib_path, load_mode::type mode = load_mode::default_mode) {
+        std::error_code ec;
+        shared_library lib = load(lib_path, mode, ec);
+        if (ec) {
+            boost::dll::detail::report_error(ec, "boost::dll::library_registry::load() failed");
+        }
+        return lib;
+    }
+
+    /*!
+    * \return Information about all the libraries in the registry.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    std::vector<library_entry> loaded_libraries() const {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+        std::vector<library_entry> ret;
+        ret.reserve(records_.size());
+        for (const record& r : records_) {
+            ret.push_back(library_entry{r.location, r.requested_paths, r.lib.native(), use_count(r.lib) - 1});
+        }
+        return ret;
+    }
+
+    /*!
+    * Drops the registry references to the libraries that are not used by any shared_library instance outside
+    * of the registry. Such libraries are unloaded if they were not loaded by other means.
+    * \return Number of the dropped libraries.
+    * \throws Nothing.
+    */
+    std::size_t release_unused() noexcept {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+        std::size_t released = 0;
+        for (auto it = records_.begin(); it != records_.end();) {
+            if (use_count(it->lib) == 1) {
+                erase_index(*it);
+                it = records_.erase(it);
+                ++released;
+            } else {
+                ++it;
+            }
+        }
+        return released;
+    }
+
+    /*!
+    * Drops the registry references to all the libraries.
+    * \throws Nothing.
+    */
+    void clear() noexcept {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        index_.clear();
+        records_.clear();
+    }
+};
+
+}} // namespace boost::dll
+
+#endif // BOOST_DLL_LIBRARY_REGISTRY_HPP
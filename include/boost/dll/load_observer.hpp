@@ -0,0 +1,190 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_LOAD_OBSERVER_HPP
+#define BOOST_DLL_LOAD_OBSERVER_HPP
+
+#include <boost/dll/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+
+/// \file boost/dll/load_observer.hpp
+/// \brief Contains the boost::dll::load_observer interface for instrumenting loading, symbol lookups and
+/// unloading of the libraries.
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Phases of the library lifetime that are reported to the boost::dll::load_observer.
+*/
+enum class load_phase {
+    path_resolution,        ///< Resolving the relative path and the load mode, appending the decorations.
+    program_location_check, ///< Checking whether the path points to the program itself. POSIX only.
+    native_load,            ///< Single call to the `dlopen` or `LoadLibraryExW`.
+    symbol_lookup,          ///< Single call to the `dlsym` or `GetProcAddress`. Lookups served from the cache are not reported.
+    unload                  ///< Call to the `dlclose` or `FreeLibrary`.
+};
+
+/// Number of values in the boost::dll::load_phase enumeration.
+constexpr std::size_t load_phases_count = 5;
+
+/*!
+* \brief Event that is reported to the boost::dll::load_observer.
+*
+* Pointers in the event are valid only during the boost::dll::load_observer::on_event() call.
+*/
+struct load_event {
+    /// Phase that has finished.
+    load_phase phase;
+
+    /// Path that was used in this phase, nullptr for load_phase::symbol_lookup and load_phase::unload.
+    const boost::dll::fs::path* path;
+
+    /// Native handle of the library, nullptr if the library was not loaded in load_phase::native_load.
+    const void* native;
+
+    /// Name of the symbol for load_phase::symbol_lookup, nullptr otherwise or if the symbol is looked up by ordinal.
+    const char* symbol;
+
+    /// Result of the phase: false if the library was not loaded, the symbol was not found,
+    /// or the path points to some other file than the program.
+    bool success;
+
+    /// Time when the phase started.
+    std::chrono::steady_clock::time_point start;
+
+    /// Duration of the phase.
+    std::chrono::nanoseconds duration;
+};
+
+/*!
+* \brief Interface for receiving instrumentation events from all the boost::dll::shared_library instances
+* of the current module.
+*
+* \b Example:
+* \code
+* struct log_slow_loads: boost::dll::load_observer {
+*     void on_event(const boost::dll::load_event& e) noexcept override {
+*         if (e.phase == boost::dll::load_phase::native_load && e.duration > std::chrono::milliseconds(100)) {
+*             std::cerr << "slow load: " << *e.path << '\n';
+*         }
+*     }
+* };
+*
+* log_slow_loads observer;
+* boost::dll::set_load_observer(&observer);
+* \endcode
+*/
+class load_observer {
+public:
+    /*!
+    * Called after each finished phase. May be called concurrently from different threads.
+    * \throws Must not throw.
+    */
+    virtual void on_event(const load_event& event) noexcept = 0;
+
+    virtual ~load_observer() = default;
+};
+
+/// @cond
+namespace detail {
+
+    inline std::atomic<boost::dll::load_observer*>& load_observer_storage() noexcept {
+        static std::atomic<boost::dll::load_observer*> observer{nullptr};
+        return observer;
+    }
+
+    // Number of the load_observer::on_event() calls in progress. set_load_observer() waits for them to finish.
+    inline std::atomic<std::size_t>& load_observer_calls() noexcept {
+        static std::atomic<std::size_t> calls{0};
+        return calls;
+    }
+
+    // Measures the time of a phase if there is an observer. Costs a single atomic load otherwise.
+    class load_event_timer {
+        const bool                                  observed_;
+        std::chrono::steady_clock::time_point       start_;
+
+    public:
+        load_event_timer() noexcept
+            : observed_(!!load_observer_storage().load(std::memory_order_acquire))
+        {
+            if (observed_) {
+                start_ = std::chrono::steady_clock::now();
+            }
+        }
+
+        void report(load_phase phase, const boost::dll::fs::path* path, const void* native, const char* symbol, bool success) const noexcept {
+            if (!observed_) {
+                return;
+            }
+
+            const boost::dll::load_event event = {
+                phase, path, native, symbol, success, start_,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_)
+            };
+
+            // The observer is used only if it is still set after the call was counted, so the
+            // set_load_observer() either sees the call in progress or the call sees the new observer.
+            std::atomic<boost::dll::load_observer*>& storage = load_observer_storage();
+            boost::dll::load_observer* const observer = storage.load();
+            if (!observer) {
+                return;
+            }
+
+            std::atomic<std::size_t>& calls = load_observer_calls();
+            calls.fetch_add(1);
+            if (storage.load() == observer) {
+                observer->on_event(event);
+            }
+            calls.fetch_sub(1, std::memory_order_release);
+        }
+    };
+
+} // namespace detail
+/// @endcond
+
+/*!
+* Sets the observer that receives events from all the boost::dll::shared_library instances of the current module.
+*
+* Waits for the load_observer::on_event() calls that are in progress in other threads to finish, so the previously
+* set observer could be destroyed right after this function returns. Phases that started before the change and
+* finish after it are reported to the new observer.
+*
+* \param observer Observer to set or nullptr to disable the instrumentation.
+* \return Previously set observer or nullptr.
+* \throws Nothing.
+* \warning Must not be called from the load_observer::on_event(), as it waits for that call to finish.
+*/
+inline load_observer* set_load_observer(load_observer* observer) noexcept {
+    load_observer* const previous = boost::dll::detail::load_observer_storage().exchange(observer);
+
+    std::atomic<std::size_t>& calls = boost::dll::detail::load_observer_calls();
+    while (calls.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+
+    return previous;
+}
+
+/*!
+* \return Currently set observer or nullptr.
+* \throws Nothing.
+*/
+inline load_observer* get_load_observer() noexcept {
+    return boost::dll::detail::load_observer_storage().load(std::memory_order_acquire);
+}
+
+}} // namespace boost::dll
+
+#endif // BOOST_DLL_LOAD_OBSERVER_HPP
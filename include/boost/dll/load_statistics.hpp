@@ -0,0 +1,209 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_LOAD_STATISTICS_HPP
+#define BOOST_DLL_LOAD_STATISTICS_HPP
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/load_observer.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/// \file boost/dll/load_statistics.hpp
+/// \brief Contains the boost::dll::load_statistics class, a boost::dll::load_observer that aggregates
+/// durations of the phases into per library histograms.
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Observer that aggregates the durations of the phases into histograms per library.
+*
+* Events for the symbol lookups and unloads are attributed to the path that was used to load the library.
+* Events for the libraries that were loaded before the observer was set are attributed to an empty path.
+*
+* \b Example:
+* \code
+* boost::dll::load_statistics stats;
+* boost::dll::set_load_observer(&stats);
+* // ... load the plugins ...
+* for (const auto& lib : stats.snapshot()) {
+*     const auto& h = lib[boost::dll::load_phase::native_load];
+*     export_metric(lib.library, h.count, h.total_ns, h.max_ns);
+* }
+* boost::dll::set_load_observer(nullptr);
+* \endcode
+*
+* All the methods are thread safe.
+*/
+class load_statistics: public load_observer {
+public:
+    /*!
+    * \brief Histogram of the phase durations with logarithmic buckets.
+    */
+    struct histogram {
+        /// Number of buckets.
+        static constexpr std::size_t buckets_count = 48;
+
+        /// Number of the events.
+        std::uint64_t count = 0;
+
+        /// Number of the events that were not successful.
+        std::uint64_t failures = 0;
+
+        /// Sum of all the durations in nanoseconds.
+        std::uint64_t total_ns = 0;
+
+        /// Minimal duration in nanoseconds or 0 if there were no events.
+        std::uint64_t min_ns = 0;
+
+        /// Maximal duration in nanoseconds.
+        std::uint64_t max_ns = 0;
+
+        /// Bucket `i` counts the durations from `2^i` (or from 0 for the first bucket) to `2^(i + 1) - 1`
+        /// nanoseconds inclusive. The last bucket also counts all the longer durations.
+        std::array<std::uint64_t, buckets_count> buckets{};
+
+        /*!
+        * \return Index of the bucket for the `duration_ns`.
+        * \throws Nothing.
+        */
+        static std::size_t bucket_index(std::uint64_t duration_ns) noexcept {
+            std::size_t index = 0;
+            while (duration_ns > 1 && index + 1 < buckets_count) {
+                duration_ns >>= 1;
+                ++index;
+            }
+            return index;
+        }
+
+        /*!
+        * Adds the duration to the histogram.
+        * \throws Nothing.
+        */
+        void add(std::uint64_t duration_ns, bool success) noexcept {
+            min_ns = (count == 0 || duration_ns < min_ns ? duration_ns : min_ns);
+            max_ns = (duration_ns > max_ns ? duration_ns : max_ns);
+            ++count;
+            failures += !success;
+            total_ns += duration_ns;
+            ++buckets[bucket_index(duration_ns)];
+        }
+    };
+
+    /*!
+    * \brief Histograms of all the phases of a single library.
+    */
+    struct library_statistics {
+        /// Path that was used to load the library.
+        boost::dll::fs::path library;
+
+        /// Histograms indexed by the boost::dll::load_phase.
+        std::array<histogram, load_phases_count> phases;
+
+        /*!
+        * \return Histogram for the `phase`.
+        * \throws Nothing.
+        */
+        const histogram& operator[](load_phase phase) const noexcept {
+            return phases[static_cast<std::size_t>(phase)];
+        }
+    };
+
+private:
+    /// @cond
+    using key_t = boost::dll::fs::path::string_type;
+
+    // Same native handle is returned for each load of the library, the path is forgotten on the last unload
+    struct loaded_path {
+        key_t           key;
+        std::size_t     loads;
+    };
+
+    mutable std::mutex                                  mutex_;
+    std::unordered_map<key_t, library_statistics>       libraries_;
+    std::unordered_map<const void*, loaded_path>        paths_by_native_;
+    /// @endcond
+
+public:
+    load_statistics() = default;
+    load_statistics(const load_statistics&) = delete;
+    load_statistics& operator=(const load_statistics&) = delete;
+
+    /*!
+    * Adds the event to the histogram of the library. Events are silently dropped in case of insufficient memory.
+    * \throws Nothing.
+    */
+    void on_event(const load_event& event) noexcept override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        try {
+            key_t key;
+            const auto it = (event.native ? paths_by_native_.find(event.native) : paths_by_native_.end());
+            if (event.path) {
+                key = event.path->native();
+            } else if (it != paths_by_native_.end()) {
+                key = it->second.key;
+            }
+
+            if (event.phase == load_phase::native_load && event.success) {
+                if (it == paths_by_native_.end()) {
+                    paths_by_native_.emplace(event.native, loaded_path{key, 1});
+                } else {
+                    ++it->second.loads;
+                }
+            } else if (event.phase == load_phase::unload && it != paths_by_native_.end() && !--it->second.loads) {
+                paths_by_native_.erase(it);
+            }
+
+            library_statistics& stats = libraries_[key];
+            if (stats.library.empty() && event.path) {
+                stats.library = *event.path;
+            }
+            stats.phases[static_cast<std::size_t>(event.phase)].add(
+                static_cast<std::uint64_t>(event.duration.count()), event.success
+            );
+        } catch (...) {
+            // Statistics are not essential
+        }
+    }
+
+    /*!
+    * \return Statistics of all the libraries.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    std::vector<library_statistics> snapshot() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::vector<library_statistics> ret;
+        ret.reserve(libraries_.size());
+        for (const auto& v : libraries_) {
+            ret.push_back(v.second);
+        }
+        return ret;
+    }
+
+    /*!
+    * Drops all the collected statistics.
+    * \throws Nothing.
+    */
+    void reset() noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        libraries_.clear();
+    }
+};
+
+}} // namespace boost::dll
+
+#endif // BOOST_DLL_LOAD_STATISTICS_HPP
@@ -0,0 +1,130 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_LOADED_LIBRARY_INFO_HPP
+#define BOOST_DLL_LOADED_LIBRARY_INFO_HPP
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/library_info.hpp>
+#include <boost/dll/shared_library.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/throw_exception.hpp>
+
+#if BOOST_OS_WINDOWS
+#   include <boost/dll/detail/windows/loaded_symbols.hpp>
+#else
+#   include <boost/dll/detail/posix/loaded_symbols.hpp>
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <string>
+#include <system_error>
+#include <vector>
+
+/// \file boost/dll/loaded_library_info.hpp
+/// \brief Contains the boost::dll::loaded_library_info class that extracts information
+/// from already loaded libraries.
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Class that is capable of extracting the exported symbols from a library that is already
+* loaded by \ref shared_library.
+*
+* On ELF platforms the dynamic symbols table is read from the memory that was mapped by the dynamic loader,
+* on Windows the export table of the loaded image is used. No file is opened or read in that case.
+* On other platforms the information is extracted from the file at `shared_library::location()`
+* using the \ref library_info.
+*
+* Only the exported symbols are reported, which are the symbols that could be obtained via
+* `shared_library::get()`. So the result may be shorter than the `library_info::symbols()` result for the
+* same file, because the latter reports all the visible symbols from the ".symtab" section if it is present.
+*
+* Instance must not outlive the \ref shared_library instance it was constructed from.
+*/
+class loaded_library_info {
+    boost::dll::detail::loaded_symbols loaded_;
+    bool from_memory_;
+    std::vector<std::string> file_symbols_;
+
+public:
+    /*!
+    * Prepares for information extraction from the loaded library.
+    * \param lib Loaded library.
+    * \throws \forcedlinkfs{system_error} if the library is not loaded, std::exception based exceptions
+    * if the file could not be parsed.
+    */
+    explicit loaded_library_info(const boost::dll::shared_library& lib)
+        : from_memory_(false)
+    {
+        if (!lib.is_loaded()) {
+            boost::throw_exception(
+                boost::dll::fs::system_error(
+                    std::make_error_code(std::errc::bad_file_descriptor),
+                    "boost::dll::loaded_library_info() failed (no library was loaded)"
+                )
+            );
+        }
+
+        from_memory_ = loaded_.init(lib.native());
+        if (!from_memory_) {
+            file_symbols_ = boost::dll::library_info(lib.location()).symbols();
+        }
+    }
+
+    /*!
+    * \return true if the symbols are read from memory and false if the file was used.
+    * \throws Nothing.
+    */
+    bool from_memory() const noexcept {
+        return from_memory_;
+    }
+
+    /*!
+    * Calls `visitor(name)` for each exported symbol.
+    * \param visitor Callable with `void(boost::core::string_view)` or `bool(boost::core::string_view)` signature.
+    * If it returns `false` the iteration stops.
+    * \throws std::exception based exceptions thrown by the visitor.
+    */
+    template <class Visitor>
+    void for_each_symbol(Visitor visitor) const {
+        const boost::dll::detail::visitor_adaptor<Visitor> f{visitor};
+        if (from_memory_) {
+            loaded_.for_each_symbol(f);
+            return;
+        }
+
+        for (const std::string& name : file_symbols_) {
+            if (!f(name)) {
+                return;
+            }
+        }
+    }
+
+    /*!
+    * \return List of the exported symbols.
+    * \throws std::bad_alloc.
+    */
+    std::vector<std::string> symbols() const {
+        if (!from_memory_) {
+            return file_symbols_;
+        }
+
+        std::vector<std::string> ret;
+        loaded_.for_each_symbol([&ret](boost::core::string_view name) {
+            ret.emplace_back(name.data(), name.size());
+            return true;
+        });
+        return ret;
+    }
+};
+
+}} // namespace boost::dll
+
+#endif // BOOST_DLL_LOADED_LIBRARY_INFO_HPP
@@ -0,0 +1,224 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_PARALLEL_LOAD_HPP
+#define BOOST_DLL_PARALLEL_LOAD_HPP
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/library_info.hpp>
+#include <boost/dll/shared_library.hpp>
+
+#if BOOST_OS_WINDOWS
+#   include <boost/dll/detail/windows/prefetch_file.hpp>
+#else
+#   include <boost/dll/detail/posix/prefetch_file.hpp>
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/// \file boost/dll/parallel_load.hpp
+/// \brief Contains the boost::dll::parallel_load function that loads multiple libraries with the
+/// file reading overlapped.
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Result of loading a single library by boost::dll::parallel_load.
+*/
+struct parallel_load_result {
+    /// Path that was passed to parallel_load.
+    boost::dll::fs::path path;
+
+    /// Loaded library or an empty instance if loading failed.
+    boost::dll::shared_library library;
+
+    /// Error of loading the library, same as reported by shared_library::load(). Errors of prefetching are ignored.
+    std::error_code error;
+
+    /// Direct dependencies of the library, as returned by library_info::dependencies(). Empty if the file could not be parsed.
+    std::vector<std::string> dependencies;
+
+    /// Position of the library in the sequence of loads.
+    std::size_t load_order = 0;
+
+    /// Time spent in reading the dependencies and prefetching the file.
+    std::chrono::nanoseconds prefetch_time{};
+
+    /// Time spent in loading the library, including the static constructors of the library.
+    std::chrono::nanoseconds load_time{};
+};
+
+/// @cond
+namespace detail {
+
+    inline void prefetch_for_load(boost::dll::parallel_load_result& r) noexcept {
+        const auto start = std::chrono::steady_clock::now();
+
+        std::error_code ignore;
+        boost::dll::detail::prefetch_file(r.path, ignore);
+
+        // Paths without the decorations or the ones that are searched in system folders are not parsed
+        try {
+            boost::dll::library_info info(r.path, boost::dll::library_info::read_mode::memory_mapped, false);
+            r.dependencies = info.dependencies();
+        } catch (const std::exception&) {
+            r.dependencies.clear();
+        }
+
+        r.prefetch_time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    }
+
+    // Returns the indexes of `results` in the order of loading: dependencies from the same set go before the
+    // libraries that require them, the rest keep the original order. Cyclic dependencies are loaded in the original order.
+    inline std::vector<std::size_t> load_sequence(const std::vector<boost::dll::parallel_load_result>& results) {
+        std::unordered_map<std::string, std::size_t> index_by_name;
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            index_by_name.emplace(results[i].path.filename().string(), i);
+        }
+
+        std::vector<std::vector<std::size_t>> required(results.size());
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            for (const std::string& name : results[i].dependencies) {
+                const auto it = index_by_name.find(boost::dll::fs::path(name).filename().string());
+                if (it != index_by_name.end() && it->second != i) {
+                    required[i].push_back(it->second);
+                }
+            }
+        }
+
+        std::vector<std::size_t> sequence;
+        sequence.reserve(results.size());
+        std::vector<bool> loaded(results.size(), false);
+        while (sequence.size() < results.size()) {
+            std::size_t next = results.size();
+            for (std::size_t i = 0; i < results.size() && next == results.size(); ++i) {
+                if (loaded[i]) {
+                    continue;
+                }
+
+                bool ready = true;
+                for (std::size_t dependency : required[i]) {
+                    ready = ready && loaded[dependency];
+                }
+                if (ready) {
+                    next = i;
+                }
+            }
+
+            if (next == results.size()) {
+                // Cycle: taking the first library that is not loaded yet
+                next = 0;
+                while (loaded[next]) {
+                    ++next;
+                }
+            }
+
+            loaded[next] = true;
+            sequence.push_back(next);
+        }
+
+        return sequence;
+    }
+
+} // namespace detail
+/// @endcond
+
+/*!
+* Loads multiple libraries, overlapping the file reading of all the libraries.
+*
+* Loading of the libraries is done in three steps:
+* - the files are prefetched into the OS file cache and their dependencies are read in parallel
+*   on `threads_count` threads. Paths that do not point to existing files (for example, the ones that
+*   require load_mode::append_decorations or load_mode::search_system_folders) are not prefetched;
+* - libraries from `paths` are sorted so that the dependencies are loaded before the libraries that require them.
+*   Dependencies are matched by the file name;
+* - libraries are loaded one by one in the calling thread, as the dynamic loader serializes the loading anyway.
+*
+* \b Example:
+* \code
+* std::vector<boost::dll::parallel_load_result> plugins = boost::dll::parallel_load(plugin_paths);
+* for (const auto& p : plugins) {
+*     std::cout << p.path << " loaded in " << p.load_time.count() << "ns\n";
+* }
+* \endcode
+*
+* \param paths Library file names, same as for shared_library::load().
+* \param mode A mode that will be used on each library load.
+* \param threads_count Number of threads for prefetching, including the calling thread.
+* 0 means std::thread::hardware_concurrency().
+* \return Results of loading in the order of the `paths`. Errors of loading are reported in the
+* parallel_load_result::error.
+* \throws std::bad_alloc in case of insufficient memory, std::system_error if a thread could not be started.
+*/
+inline std::vector<parallel_load_result> parallel_load(const std::vector<boost::dll::fs::path>& paths,
+    load_mode::type mode = load_mode::default_mode, std::size_t threads_count = 0)
+{
+    std::vector<parallel_load_result> results(paths.size());
+    for (std::size_t i = 0; i < paths.size(); ++i) {
+        results[i].path = paths[i];
+    }
+
+    if (!threads_count) {
+        threads_count = std::thread::hardware_concurrency();
+    }
+    if (threads_count > results.size()) {
+        threads_count = results.size();
+    }
+
+    std::atomic<std::size_t> next_index{0};
+    const auto worker = [&results, &next_index]() noexcept {
+        for (std::size_t i = next_index++; i < results.size(); i = next_index++) {
+            boost::dll::detail::prefetch_for_load(results[i]);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threads_count);
+    try {
+        for (std::size_t i = 1; i < threads_count; ++i) {
+            threads.emplace_back(worker);
+        }
+    } catch (...) {
+        next_index = results.size();
+        for (std::thread& t : threads) {
+            t.join();
+        }
+        throw;
+    }
+
+    worker();
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    const std::vector<std::size_t> sequence = boost::dll::detail::load_sequence(results);
+    for (std::size_t order = 0; order < sequence.size(); ++order) {
+        parallel_load_result& r = results[sequence[order]];
+        r.load_order = order;
+
+        const auto start = std::chrono::steady_clock::now();
+        r.library.load(r.path, mode, r.error);
+        r.load_time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    }
+
+    return results;
+}
+
+}} // namespace boost::dll
+
+#endif // BOOST_DLL_PARALLEL_LOAD_HPP
@@ -25,8 +25,11 @@
 #   include <boost/dll/detail/posix/shared_library_impl.hpp>
 #endif
 
+#include <initializer_list>
+#include <string>
 #include <type_traits>
 #include <utility>  // std::move
+#include <vector>
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
 # pragma once
@@ -34,6 +37,36 @@
 
 namespace boost { namespace dll {
 
+/// @cond
+class library_registry;
+/// @endcond
+
+/*!
+* \brief Pair of a pointer data member and the name of the symbol for shared_library::get_all().
+* Use boost::dll::make_symbol_member() to construct.
+*/
+template <class Struct, class Pointer>
+struct symbol_member {
+    static_assert(std::is_pointer<Pointer>::value, "boost::dll::symbol_member: data member must be a pointer to function or object");
+
+    /// Pointer to the data member that receives the address of the symbol.
+    Pointer Struct::* member;
+
+    /// Null-terminated name of the symbol.
+    const char* name;
+};
+
+/*!
+* \param member Pointer to the data member that receives the address of the symbol.
+* \param name Null-terminated name of the symbol, must outlive the returned object.
+* \return symbol_member for shared_library::get_all().
+* \throw Nothing.
+*/
+template <class Struct, class Pointer>
+symbol_member<Struct, Pointer> make_symbol_member(Pointer Struct::* member, const char* name) noexcept {
+    return symbol_member<Struct, Pointer>{member, name};
+}
+
 /*!
 * \brief This class can be used to load a
 *        Dynamic link libraries (DLL's) or Shared Libraries, also know
@@ -53,6 +86,10 @@ class shared_library
 {
     typedef boost::dll::detail::shared_library_impl base_t;
 
+    /// @cond
+    friend class boost::dll::library_registry;
+    /// @endcond
+
 public:
 #ifdef BOOST_DLL_DOXYGEN
     typedef platform_specific native_handle_t;
@@ -70,7 +107,8 @@ public:
 
     /*!
     * Copy constructor that increments the reference count of an underlying shared library.
-    * Same as calling constructor with `lib.location()` parameter.
+    * Does not search for the library and does not allocate memory if `lib` was loaded by
+    * the shared_library. Same as calling constructor with `lib.location()` parameter otherwise.
     *
     * \param lib A library to copy.
     * \post lib == *this
@@ -84,7 +122,8 @@ public:
 
     /*!
     * Copy constructor that increments the reference count of an underlying shared library.
-    * Same as calling constructor with `lib.location(), ec` parameters.
+    * Does not search for the library and does not allocate memory if `lib` was loaded by
+    * the shared_library. Same as calling constructor with `lib.location(), ec` parameters otherwise.
     *
     * \param lib A shared library to copy.
     * \param ec Variable that will be set to the result of the operation.
@@ -208,6 +247,11 @@ public:
             return *this;
         }
 
+        // Libraries loaded by this library share the reference counter, no need to load again
+        if (base_t::share(lib)) {
+            return *this;
+        }
+
         boost::dll::fs::path loc = lib.location(ec);
         if (ec) {
             return *this;
@@ -325,7 +369,7 @@ public:
     */
     bool has(const char* symbol_name) const noexcept {
         std::error_code ec;
-        return is_loaded() && !!base_t::symbol_addr(symbol_name, ec) && !ec;
+        return is_loaded() && !!base_t::cached_symbol_addr(symbol_name, ec) && !ec;
     }
 
     //! \overload bool has(const char* symbol_name) const
@@ -338,6 +382,10 @@ public:
     * This call will always succeed and throw nothing if call to `has(const char* )`
     * member function with the same symbol name returned `true`.
     *
+    * Found addresses are cached and shared between the copies of the library, so repeated
+    * calls with the same name do not query the dynamic loader. Use boost::dll::bound_symbol
+    * to skip the lookup completely.
+    *
     * \b Example:
     * \code
     * int& i0 = lib.get<int>("integer_name");
@@ -399,8 +447,92 @@ public:
         return *get<T*>(alias_name.c_str());
     }
 
+    /*!
+    * Resolves multiple symbols at once and assigns their addresses to the data members of `s`. Members are
+    * assigned only if all the symbols were found.
+    *
+    * \b Example:
+    * \code
+    * struct plugin_api {
+    *     int (*create)();
+    *     void (*destroy)(int);
+    *     int* counter;
+    * };
+    *
+    * plugin_api api;
+    * lib.get_all(api,
+    *     boost::dll::make_symbol_member(&plugin_api::create, "create"),
+    *     boost::dll::make_symbol_member(&plugin_api::destroy, "destroy"),
+    *     boost::dll::make_symbol_member(&plugin_api::counter, "counter")
+    * );
+    * \endcode
+    *
+    * \param s Structure to fill.
+    * \param ec Variable that will be set to the result of the operation.
+    * \param members Data members and names of the symbols.
+    * \return Names of all the symbols that were not found.
+    * \throw std::bad_alloc in case of insufficient memory.
+    */
+    template <class Struct, class... Pointers>
+    std::vector<std::string> get_all(Struct& s, std::error_code& ec, const symbol_member<Struct, Pointers>&... members) const {
+        static_assert(sizeof...(Pointers) > 0, "boost::dll::shared_library::get_all() requires at least one symbol");
+
+        ec.clear();
+        std::vector<std::string> missing;
+        void* const addresses[sizeof...(Pointers)] = { resolve_for_batch(members.name, missing)... };
+        if (!missing.empty()) {
+            ec = std::make_error_code(
+                is_loaded() ? std::errc::invalid_seek : std::errc::bad_file_descriptor
+            );
+            return missing;
+        }
+
+        std::size_t i = 0;
+        (void)std::initializer_list<int>{
+            (s.*(members.member) = boost::dll::detail::aggressive_ptr_cast<Pointers>(addresses[i++]), 0)...
+        };
+        return missing;
+    }
+
+    /*!
+    * Resolves multiple symbols at once and assigns their addresses to the data members of `s`. Members are
+    * assigned only if all the symbols were found.
+    *
+    * \param s Structure to fill.
+    * \param members Data members and names of the symbols.
+    * \throw \forcedlinkfs{system_error} with names of all the missing symbols if some symbols do not exist
+    * or if the DLL/DSO was not loaded.
+    */
+    template <class Struct, class... Pointers>
+    void get_all(Struct& s, const symbol_member<Struct, Pointers>&... members) const {
+        std::error_code ec;
+        const std::vector<std::string> missing = get_all(s, ec, members...);
+        if (ec) {
+            report_missing(ec, missing);
+        }
+    }
+
 private:
     /// @cond
+    void* resolve_for_batch(const char* name, std::vector<std::string>& missing) const {
+        std::error_code ec;
+        void* const ret = (is_loaded() ? base_t::cached_symbol_addr(name, ec) : nullptr);
+        if (!ret) {
+            missing.emplace_back(name);
+        }
+        return ret;
+    }
+
+    static void report_missing(const std::error_code& ec, const std::vector<std::string>& missing) {
+        std::string message = "boost::dll::shared_library::get_all() failed, missing symbols:";
+        for (const std::string& name : missing) {
+            message += ' ';
+            message += name;
+        }
+
+        boost::throw_exception(boost::dll::fs::system_error(ec, message));
+    }
+
     // get_void is required to reduce binary size: it does not depend on a template
     // parameter and will be instantiated only once.
     void* get_void(const char* sb) const {
@@ -419,7 +551,7 @@ private:
             );
         }
 
-        void* const ret = base_t::symbol_addr(sb, ec);
+        void* const ret = base_t::cached_symbol_addr(sb, ec);
         if (ec || !ret) {
             boost::dll::detail::report_error(ec, "boost::dll::shared_library::get() failed");
         }
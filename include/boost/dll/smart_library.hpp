@@ -99,7 +99,7 @@ public:
     //! \copydoc shared_library::shared_library(const boost::dll::fs::path& lib_path, load_mode::type mode = load_mode::default_mode)
     smart_library(const boost::dll::fs::path& lib_path, load_mode::type mode = load_mode::default_mode) {
         lib_.load(lib_path, mode);
-        storage_.load(lib_path);
+        storage_.load(lib_);
     }
 
     //! \copydoc shared_library::shared_library(const boost::dll::fs::path& lib_path, boost::dll::fs::error_code& ec, load_mode::type mode = load_mode::default_mode)
@@ -138,7 +138,7 @@ public:
       explicit smart_library(const shared_library & lib) noexcept
           : lib_(lib)
       {
-          storage_.load(lib.location());
+          storage_.load(lib_);
       }
      /*!
      * Construct from a shared_library object.
@@ -150,7 +150,7 @@ public:
      explicit smart_library(shared_library&& lib) noexcept
          : lib_(std::move(lib))
      {
-         storage_.load(lib.location());
+         storage_.load(lib_);
      }
 
     /*!
@@ -166,26 +166,35 @@ public:
     //! \copydoc shared_library::load(const boost::dll::fs::path& lib_path, load_mode::type mode = load_mode::default_mode)
     void load(const boost::dll::fs::path& lib_path, load_mode::type mode = load_mode::default_mode) {
         boost::dll::fs::error_code ec;
-        storage_.load(lib_path);
         lib_.load(lib_path, mode, ec);
 
         if (ec) {
+            storage_.clear();
             boost::dll::detail::report_error(ec, "load() failed");
         }
+        storage_.load(lib_);
     }
 
     //! \copydoc shared_library::load(const boost::dll::fs::path& lib_path, boost::dll::fs::error_code& ec, load_mode::type mode = load_mode::default_mode)
     void load(const boost::dll::fs::path& lib_path, boost::dll::fs::error_code& ec, load_mode::type mode = load_mode::default_mode) {
         ec.clear();
-        storage_.load(lib_path);
         lib_.load(lib_path, mode, ec);
+        if (ec) {
+            storage_.clear();
+        } else {
+            storage_.load(lib_);
+        }
     }
 
     //! \copydoc shared_library::load(const boost::dll::fs::path& lib_path, load_mode::type mode, boost::dll::fs::error_code& ec)
     void load(const boost::dll::fs::path& lib_path, load_mode::type mode, boost::dll::fs::error_code& ec) {
         ec.clear();
-        storage_.load(lib_path);
         lib_.load(lib_path, mode, ec);
+        if (ec) {
+            storage_.clear();
+        } else {
+            storage_.load(lib_);
+        }
     }
 
     /*!
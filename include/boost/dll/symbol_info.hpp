@@ -0,0 +1,65 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_SYMBOL_INFO_HPP
+#define BOOST_DLL_SYMBOL_INFO_HPP
+
+#include <boost/dll/config.hpp>
+#include <boost/core/detail/string_view.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstdint>
+
+/// \file boost/dll/symbol_info.hpp
+/// \brief Contains the boost::dll::symbol_info structure that describes a symbol of a binary file.
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Kind of entity the symbol refers to.
+*/
+enum class symbol_type {
+    unknown,    ///< Format does not provide the information or the symbol is a forwarder to another binary
+    function,   ///< Executable code
+    object,     ///< Data
+    tls         ///< Thread local data
+};
+
+/*!
+* \brief Binding of the symbol.
+*/
+enum class symbol_binding {
+    global,     ///< Symbol could not be overridden by other definitions
+    weak        ///< Symbol could be overridden by a global definition with the same name
+};
+
+/*!
+* \brief Information about a symbol extracted from the symbols table of a binary file by
+* boost::dll::library_info::for_each_symbol_info().
+*/
+struct symbol_info {
+    /// Name of the symbol. Valid only during the visitor call.
+    boost::core::string_view name;
+
+    /// Value of the symbol: the virtual address for ELF and Mach-O, the relative virtual address for PE.
+    std::uint64_t address;
+
+    /// Size of the symbol in bytes. Only ELF provides the size, it is 0 for other formats.
+    std::uint64_t size;
+
+    /// Kind of entity the symbol refers to.
+    boost::dll::symbol_type type;
+
+    /// Binding of the symbol. Always boost::dll::symbol_binding::global for PE.
+    boost::dll::symbol_binding binding;
+};
+
+}} // namespace boost::dll
+
+#endif // BOOST_DLL_SYMBOL_INFO_HPP
@@ -0,0 +1,83 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/async_load.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <functional>
+#include <thread>
+#include <vector>
+
+// Unit Tests
+
+struct thread_executor {
+    std::vector<std::thread>& threads;
+
+    void operator()(std::function<void()> task) const {
+        threads.emplace_back(std::move(task));
+    }
+};
+
+int main(int argc, char* argv[]) {
+    using namespace boost::dll;
+
+    const boost::dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+    const boost::dll::fs::path missing_path = shared_library_path.parent_path() / "library_that_does_not_exist";
+
+    {
+        std::future<shared_library> f = async_load(shared_library_path);
+        shared_library lib = f.get();
+        BOOST_TEST(lib.is_loaded());
+        BOOST_TEST(lib.has("integer_g"));
+
+        BOOST_TEST_THROWS(async_load(missing_path).get(), std::exception);
+    }
+
+    {
+        std::vector<std::thread> threads;
+        std::future<shared_library> f = async_load(shared_library_path, load_mode::default_mode, thread_executor{threads});
+        std::future<shared_library> missing = async_load(missing_path, load_mode::default_mode, thread_executor{threads});
+        BOOST_TEST_EQ(threads.size(), 2u);
+
+        BOOST_TEST(f.get().has("integer_g"));
+        BOOST_TEST_THROWS(missing.get(), std::exception);
+
+        for (std::thread& t : threads) {
+            t.join();
+        }
+    }
+
+    {
+        std::error_code ec_loaded, ec_missing;
+        shared_library loaded, not_loaded;
+        const auto inline_executor = [](std::function<void()> task) { task(); };
+
+        async_load(shared_library_path, load_mode::default_mode, inline_executor,
+            [&](std::error_code ec, shared_library lib) {
+                ec_loaded = ec;
+                loaded = std::move(lib);
+            }
+        );
+        async_load(missing_path, load_mode::default_mode, inline_executor,
+            [&](std::error_code ec, shared_library lib) {
+                ec_missing = ec;
+                not_loaded = std::move(lib);
+            }
+        );
+
+        BOOST_TEST(!ec_loaded);
+        BOOST_TEST(loaded.has("integer_g"));
+        BOOST_TEST(ec_missing);
+        BOOST_TEST(!not_loaded.is_loaded());
+    }
+
+    return boost::report_errors();
+}
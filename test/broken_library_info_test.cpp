@@ -63,6 +63,12 @@ int main(int argc, char* argv[]) {
         lib_info.sections();
         BOOST_TEST(false);
     } catch (const std::exception& ) {}
+
+    try {
+        boost::dll::library_info lib_info(corrupted_binary.string(), boost::dll::library_info::read_mode::memory_mapped);
+        lib_info.sections();
+        BOOST_TEST(false);
+    } catch (const std::exception& ) {}
 #endif
 
     return boost::report_errors();
@@ -224,5 +224,23 @@ int main(int argc, char* argv[])
     }
 
     std::cerr << 28 << ' ';
+    {
+        // Symbols of the previous library are dropped on a failed load
+        const boost::dll::fs::path missing = pt.parent_path() / "library_that_does_not_exist";
+        smart_library lib(pt);
+        BOOST_TEST(!lib.symbol_storage().get_storage().empty());
+
+        boost::dll::fs::error_code ec;
+        lib.load(missing, ec);
+        BOOST_TEST(ec);
+        BOOST_TEST(!lib.is_loaded());
+        BOOST_TEST(lib.symbol_storage().get_storage().empty());
+
+        lib.load(pt);
+        BOOST_TEST(!lib.symbol_storage().get_storage().empty());
+        BOOST_TEST_THROWS(lib.load(missing), std::exception);
+        BOOST_TEST(lib.symbol_storage().get_storage().empty());
+    }
+
     return boost::report_errors();
 }
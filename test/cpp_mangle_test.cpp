@@ -123,6 +123,69 @@ int main(int argc, char* argv[])
 
 #endif // #ifndef BOOST_NO_RTTI
 
+    // `ms` is scanned linearly after the get_storage() call, the copy uses the indexes by the demangled names
+    // and a new storage demangles only the symbols that contain the looked up identifier
+    mangled_storage indexed(ms);
+    mangled_storage lazy(lib);
+    lazy.add_alias<override_class>("some_space::some_class");
+    for (const mangled_storage* s : {&indexed, &lazy})
+    {
+        BOOST_TEST_EQ(s->get_variable<double>("some_space::variable"), ms.get_variable<double>("some_space::variable"));
+        BOOST_TEST(s->get_variable<double>("some_space::variable_typo").empty());
+        BOOST_TEST_EQ(s->get_variable<int>("unscoped_var"), ms.get_variable<int>("unscoped_var"));
+        BOOST_TEST_EQ(s->get_function<void(const double)>("overloaded"), v1);
+        BOOST_TEST_EQ(s->get_function<void(const volatile int)>("overloaded"), v2);
+        BOOST_TEST_EQ((s->get_mem_fn<override_class, int(int, int)>("func")), v);
+#if !defined(_MSC_VER)
+        BOOST_TEST_EQ(s->get_constructor<override_class(int)>().C1, ctor2.C1);
+        BOOST_TEST_EQ(s->get_destructor<override_class>().D1, dtor.D1);
+#endif
+    }
+
+#if !defined(_MSC_VER)
+    {
+        detail::itanium_mangler mangler(ms);
+        BOOST_TEST_EQ(mangler.variable<double>("some_space::variable"), "_ZN10some_space8variableE");
+        BOOST_TEST_EQ(mangler.variable<int>("unscoped_var"), "unscoped_var");
+        BOOST_TEST_EQ(mangler.function<void(const double)>("overloaded"), "_Z10overloadedd");
+        BOOST_TEST_EQ(mangler.function<void(const int &)>("some_space::some_class::set_value"), "_ZN10some_space10some_class9set_valueERKi");
+        BOOST_TEST_EQ((mangler.mem_fn<override_class, int(int, int)>("func")), "_ZN10some_space10some_class4funcEii");
+        BOOST_TEST_EQ((mangler.mem_fn<const volatile override_class, double(double, double)>("func")), "_ZNVK10some_space10some_class4funcEdd");
+        BOOST_TEST_EQ(mangler.constructor<override_class(override_class&&)>("C1"), "_ZN10some_space10some_classC1EOS0_");
+        BOOST_TEST_EQ(mangler.destructor<override_class>("D0"), "_ZN10some_space10some_classD0Ev");
+        BOOST_TEST_EQ(mangler.type_info<override_class>(), "_ZTIN10some_space10some_classE");
+        // Same identifier rules as the index of mangled_storage_base
+        BOOST_TEST_EQ(mangler.function<void()>("some_space::dollar$name"), "_ZN10some_space11dollar$nameEv");
+        BOOST_TEST(mangler.function<void()>("some_space::1st").empty());
+        BOOST_TEST_EQ(mangler.function<void(override_class*, const override_class*, override_class*)>("some_space::f"),
+            "_ZN10some_space1fEPNS_10some_classEPKS0_S1_");
+
+        // Not supported, resolved by demangling
+        BOOST_TEST(mangler.function<void(boost::variant<int, double> &)>("use_variant").empty());
+        BOOST_TEST(mangler.function<void()>("some_space::operator+").empty());
+
+        BOOST_TEST_EQ(ms.get_function<void(const int &)>("some_space::some_class::set_value"), "_ZN10some_space10some_class9set_valueERKi");
+        BOOST_TEST_EQ(ms.get_constructor<override_class(override_class&&)>().C2, "_ZN10some_space10some_classC2EOS0_");
+    }
+#endif
+
+    {
+        std::vector<std::string> symbols;
+        for (int i = 0; i < 5000; ++i)
+            symbols.push_back("_ZN10some_space3fooILi" + std::to_string(i) + "EEEvRKSsPi");
+
+        mangled_storage serial(symbols);
+        mangled_storage parallel(symbols);
+        parallel.set_demangle_threads(4);
+        parallel.demangle_all();
+
+        const auto & expected = serial.get_storage();
+        const auto & demangled = parallel.get_storage();
+        BOOST_TEST_EQ(demangled.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size() && i < demangled.size(); ++i)
+            BOOST_TEST_EQ(demangled[i].demangled, expected[i].demangled);
+    }
+
     return boost::report_errors();
 }
 
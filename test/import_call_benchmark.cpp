@@ -0,0 +1,66 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+// Compares the cost of calling a function from the library via different wrappers.
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/import.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+
+namespace {
+
+constexpr int iterations = 10000000;
+
+template <class F>
+void measure(const char* name, const F& f) {
+    const auto start = std::chrono::steady_clock::now();
+    int value = 0;
+    for (int i = 0; i < iterations; ++i) {
+        value = f(value);
+    }
+    const auto finish = std::chrono::steady_clock::now();
+
+    BOOST_TEST_EQ(value, iterations);
+    std::cout << name << ": "
+        << std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count() / static_cast<double>(iterations)
+        << " ns per call" << std::endl;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[]) {
+    using namespace boost::dll;
+
+    const boost::dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+
+    shared_library lib(shared_library_path);
+
+    int (* const volatile direct)(int) = &lib.get<int(int)>("increment");
+    measure("direct call", [direct](int v) { return direct(v); });
+
+    const raw_function<int(int)> raw = import_symbol<int(int)>(lib, "increment");
+    BOOST_TEST(raw.get() == direct);
+    BOOST_TEST(raw.lifetime() == lib);
+    measure("raw_function", raw);
+
+    // Implementation that was used by boost::dll::import_symbol before, call through the aliased shared_ptr
+    const std::shared_ptr<int(int)> aliased(std::make_shared<shared_library>(lib), raw.get());
+    measure("aliased shared_ptr", [&aliased](int v) { return (*aliased)(v); });
+
+    const std::function<int(int)> function = raw;
+    measure("std::function", function);
+
+    return boost::report_errors();
+}
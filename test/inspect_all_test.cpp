@@ -0,0 +1,81 @@
+// Copyright Antony Polukhin, 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/inspect_all.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+// Unit Tests
+
+#include <thread>
+
+namespace {
+
+void check_results(const std::vector<boost::dll::inspection_result>& results, const boost::dll::fs::path& lib_path) {
+    BOOST_TEST_EQ(results.size(), 4u);
+    for (std::size_t i = 0; i < 3; ++i) {
+        BOOST_TEST(results[i].path == lib_path);
+        BOOST_TEST(!results[i].error);
+        BOOST_TEST(results[i].format == boost::dll::library_info(lib_path).format());
+        BOOST_TEST_EQ(results[i].symbols.size(), 1u);
+        BOOST_TEST(!results[i].symbols.empty() && results[i].symbols.front() == "say_hello");
+    }
+
+    BOOST_TEST(results.back().path == "file_that_does_not_exist");
+    BOOST_TEST(!!results.back().error);
+    BOOST_TEST(results.back().symbols.empty());
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    const boost::dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+
+    const std::vector<boost::dll::fs::path> paths = {
+        shared_library_path, shared_library_path, shared_library_path, "file_that_does_not_exist"
+    };
+    const auto pred = [](boost::core::string_view name) { return name == "say_hello"; };
+
+    check_results(boost::dll::inspect_all(paths, pred), shared_library_path);
+
+    // Inline executor
+    check_results(boost::dll::inspect_all(paths, pred, [](std::function<void()> task) { task(); }), shared_library_path);
+
+    // Thread per task executor
+    std::vector<std::thread> threads;
+    check_results(
+        boost::dll::inspect_all(paths, pred, [&threads](std::function<void()> task) {
+            threads.emplace_back(std::move(task));
+        }),
+        shared_library_path
+    );
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    // Executor that fails to schedule tasks
+    std::size_t scheduled = 0;
+    BOOST_TEST_THROWS(
+        boost::dll::inspect_all(paths, pred, [&scheduled](std::function<void()> task) {
+            if (scheduled == 2) {
+                throw std::runtime_error("no more tasks");
+            }
+            ++scheduled;
+            task();
+        }),
+        std::runtime_error
+    );
+    BOOST_TEST_EQ(scheduled, 2u);
+
+    BOOST_TEST(boost::dll::inspect_all(std::vector<boost::dll::fs::path>{}, pred).empty());
+
+    return boost::report_errors();
+}
@@ -0,0 +1,51 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/interface_table.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+// Unit Tests
+
+// Must be the same as in test_library.cpp
+struct test_library_table {
+    int (*increment)(int);
+    float (*lib_version)();
+    int* integer;
+};
+
+int main(int argc, char* argv[]) {
+    using namespace boost::dll;
+
+    const boost::dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+
+    {
+        interface_table<test_library_table> table(shared_library_path, "test_library_table_v1");
+        BOOST_TEST(table.library().is_loaded());
+        BOOST_TEST_EQ(table->increment(1), 2);
+        BOOST_TEST_EQ((*table).lib_version(), 1.0f);
+        BOOST_TEST_EQ(*table->integer, 100);
+        BOOST_TEST_EQ(table->integer, &table.library().get<int>("integer_g"));
+    }
+
+    {
+        shared_library lib(shared_library_path);
+        interface_table<test_library_table> table(lib, std::string("test_library_table_v1"));
+        BOOST_TEST(table.library() == lib);
+
+        // Table keeps the library loaded
+        lib.unload();
+        BOOST_TEST_EQ(table->increment(41), 42);
+
+        BOOST_TEST_THROWS(interface_table<test_library_table>(table.library(), "missing_table"), std::exception);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,161 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/library_index.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <string>
+
+// Unit Tests
+
+namespace {
+
+void replace_file(const boost::dll::fs::path& from, const boost::dll::fs::path& to) {
+    boost::dll::fs::remove(to);
+    boost::dll::fs::copy_file(from, to);
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    const boost::dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+
+    const boost::dll::fs::path dir = boost::dll::fs::temp_directory_path()
+        / ("boost_dll_library_index_test_" + std::to_string(static_cast<unsigned long long>(std::time(nullptr))));
+    boost::dll::fs::create_directories(dir);
+    const boost::dll::fs::path index_path = dir / "symbols.index";
+    const boost::dll::fs::path library_copy = dir / shared_library_path.filename();
+    replace_file(shared_library_path, library_copy);
+    // Modification time could be restored only with the precision of the file system library
+    boost::dll::fs::last_write_time(library_copy, boost::dll::fs::last_write_time(library_copy));
+
+    boost::dll::library_info info(shared_library_path);
+    const std::vector<std::string> symbols = info.symbols();
+    const std::vector<std::string> sections = info.sections();
+
+    {
+        boost::dll::library_index index(index_path); // no such file yet
+        BOOST_TEST(index.symbols(shared_library_path) == symbols);
+        BOOST_TEST(index.sections(shared_library_path) == sections);
+        BOOST_TEST(index.symbols(library_copy) == symbols);
+        index.save(index_path);
+    }
+
+    {
+        boost::dll::library_index index(index_path);
+        BOOST_TEST(index.symbols(shared_library_path) == symbols);
+        BOOST_TEST(index.sections(shared_library_path) == sections);
+
+        const auto demangled = index.demangled_symbols(library_copy);
+        BOOST_TEST_EQ(demangled.size(), symbols.size());
+        for (std::size_t i = 0; i < demangled.size() && i < symbols.size(); ++i) {
+            BOOST_TEST_EQ(demangled[i].first, symbols[i]);
+            BOOST_TEST(!demangled[i].second.empty());
+        }
+
+        // Only the second library was requested, the first one must be preserved
+        index.save(index_path);
+    }
+
+    // Warm start serves the entries without parsing the binary. Overwriting the contents in place keeps the inode
+    // and the size, restoring the modification time makes the binary look unmodified.
+    {
+        const auto mtime = boost::dll::fs::last_write_time(library_copy);
+        {
+            const std::string garbage(static_cast<std::size_t>(boost::dll::fs::file_size(library_copy)), '\0');
+            std::fstream fs(library_copy.string(), std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+            fs.write(garbage.data(), static_cast<std::streamsize>(garbage.size()));
+        }
+        boost::dll::fs::last_write_time(library_copy, mtime);
+        BOOST_TEST_THROWS(boost::dll::library_info{library_copy}, std::exception);
+
+        boost::dll::library_index index(index_path);
+        BOOST_TEST(index.symbols(library_copy) == symbols);
+        BOOST_TEST(index.sections(library_copy) == sections);
+        BOOST_TEST_EQ(index.demangled_symbols(library_copy).size(), symbols.size());
+    }
+
+    // No temporary files are left behind
+    {
+        std::size_t files_count = 0;
+        for (boost::dll::fs::directory_iterator it(dir), end; it != end; ++it) {
+            ++files_count;
+        }
+        BOOST_TEST_EQ(files_count, 2u);
+    }
+
+    // Modified binary must be parsed again
+    replace_file(boost::dll::fs::path(argv[0]), library_copy);
+    {
+        boost::dll::library_index index(index_path);
+        BOOST_TEST(index.symbols(shared_library_path) == symbols);
+        BOOST_TEST(index.symbols(library_copy) == boost::dll::library_info(library_copy).symbols());
+        BOOST_TEST(index.symbols(library_copy) != symbols);
+        BOOST_TEST_EQ(index.demangled_symbols(library_copy).size(), index.symbols(library_copy).size());
+    }
+
+    // Entry with fewer demangled names than symbols is parsed again
+    {
+        const boost::dll::fs::path demangled_index_path = dir / "demangled.index";
+        {
+            boost::dll::library_index index;
+            BOOST_TEST_EQ(index.demangled_symbols(shared_library_path).size(), symbols.size());
+            index.save(demangled_index_path);
+        }
+
+        // header_t is 24 bytes, the only entry_t starts right after it and ends with the `demangled` list count
+        const std::size_t demangled_count_offset = 24 + 88;
+        std::fstream fs(demangled_index_path.string(), std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+        std::uint64_t count = 0;
+        fs.seekg(demangled_count_offset);
+        fs.read(reinterpret_cast<char*>(&count), sizeof(count));
+        BOOST_TEST_EQ(count, symbols.size());
+        --count;
+        fs.seekp(demangled_count_offset);
+        fs.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        fs.close();
+
+        boost::dll::library_index index(demangled_index_path);
+        const auto demangled = index.demangled_symbols(shared_library_path);
+        BOOST_TEST_EQ(demangled.size(), symbols.size());
+        for (std::size_t i = 0; i < demangled.size() && i < symbols.size(); ++i) {
+            BOOST_TEST_EQ(demangled[i].first, symbols[i]);
+        }
+        boost::dll::fs::remove(demangled_index_path);
+    }
+
+    // Corrupted index is ignored
+    {
+        std::ofstream ofs(index_path.string(), std::ios_base::binary | std::ios_base::trunc);
+        ofs << "BDLLIDX garbage that is not an index";
+    }
+    {
+        boost::dll::library_index index(index_path);
+        BOOST_TEST(index.symbols(shared_library_path) == symbols);
+
+        std::error_code ec;
+        index.save(index_path, ec);
+        BOOST_TEST(!ec);
+    }
+
+    {
+        boost::dll::library_index index(index_path);
+        BOOST_TEST(index.symbols(shared_library_path) == symbols);
+        BOOST_TEST_THROWS(index.symbols(dir / "file_that_does_not_exist"), std::exception);
+    }
+
+    boost::dll::fs::remove_all(dir);
+
+    return boost::report_errors();
+}
@@ -17,8 +17,35 @@
 
 // Unit Tests
 
+#include <cstring>
+#include <fstream>
 #include <iterator>
 
+namespace {
+
+class vector_reader: public boost::dll::binary_reader {
+    const std::vector<unsigned char>& data_;
+
+public:
+    std::uint64_t bytes_read = 0;
+
+    explicit vector_reader(const std::vector<unsigned char>& data)
+        : data_(data)
+    {}
+
+    std::uint64_t size() const override {
+        return data_.size();
+    }
+
+    void read(std::uint64_t offset, char* buffer, std::size_t size) override {
+        BOOST_TEST(offset + size <= data_.size());
+        std::memcpy(buffer, data_.data() + offset, size);
+        bytes_read += size;
+    }
+};
+
+} // anonymous namespace
+
 int main(int argc, char* argv[])
 {
     boost::dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
@@ -55,6 +82,124 @@ int main(int argc, char* argv[])
 
     BOOST_TEST(lib_info.symbols("section_that_does_not_exist").empty());
 
+    // Test library depends at least on the C++ runtime
+    BOOST_TEST(!lib_info.dependencies().empty());
+
+    {
+        const boost::dll::names_view sec_view = lib_info.sections_view();
+        BOOST_TEST(std::vector<std::string>(sec_view.begin(), sec_view.end()) == lib_info.sections());
+
+        const boost::dll::names_view symb_view = lib_info.symbols_view();
+        BOOST_TEST(std::vector<std::string>(symb_view.begin(), symb_view.end()) == lib_info.symbols());
+
+        const boost::dll::names_view section_view = lib_info.symbols_view("boostdll");
+        BOOST_TEST(std::vector<std::string>(section_view.begin(), section_view.end()) == symb);
+        BOOST_TEST(lib_info.symbols_view("section_that_does_not_exist").empty());
+    }
+
+    {
+        std::vector<std::string> visited;
+        lib_info.for_each_symbol("boostdll", [&visited](boost::core::string_view name) {
+            visited.emplace_back(name.data(), name.size());
+        });
+        BOOST_TEST(visited == symb);
+
+        std::size_t calls = 0;
+        lib_info.for_each_symbol([&calls](boost::core::string_view) {
+            ++calls;
+            return calls < 2;
+        });
+        BOOST_TEST_EQ(calls, 2u);
+
+        BOOST_TEST_EQ(lib_info.find_symbol("boostdll", [](boost::core::string_view name) {
+            return name == "foo_variable";
+        }), "foo_variable");
+        BOOST_TEST_EQ(lib_info.find_symbol([](boost::core::string_view name) {
+            return name == "say_hello";
+        }), "say_hello");
+        BOOST_TEST(lib_info.find_symbol("boostdll", [](boost::core::string_view name) {
+            return name == "say_hello";
+        }).empty());
+    }
+
+    for (const std::string& name : lib_info.symbols()) {
+        BOOST_TEST(lib_info.has_symbol(name, boost::dll::library_info::symbol_search::all));
+    }
+    BOOST_TEST(!lib_info.has_symbol("symbol_that_does_not_exist"));
+    BOOST_TEST(!lib_info.has_symbol("symbol_that_does_not_exist", boost::dll::library_info::symbol_search::all));
+    BOOST_TEST(!lib_info.has_symbol(""));
+
+    {
+        std::vector<std::string> names;
+        lib_info.for_each_symbol_info([&names, &lib_info](const boost::dll::symbol_info& info) {
+            names.emplace_back(info.name.data(), info.name.size());
+
+            if (info.name == "say_hello") {
+                BOOST_TEST(info.type == boost::dll::symbol_type::function);
+                BOOST_TEST(info.binding == boost::dll::symbol_binding::global);
+                BOOST_TEST(info.address != 0);
+            } else if (info.name == "const_integer_g" || info.name == "integer_g") {
+                BOOST_TEST(info.type == boost::dll::symbol_type::object);
+                BOOST_TEST(info.address != 0);
+                if (lib_info.format() == boost::dll::library_info::binary_format::elf32
+                    || lib_info.format() == boost::dll::library_info::binary_format::elf64)
+                {
+                    BOOST_TEST_EQ(info.size, sizeof(int));
+                }
+            }
+        });
+        BOOST_TEST(names == lib_info.symbols());
+    }
+
+    // Memory mapped file must provide the same info
+    {
+        boost::dll::library_info mapped_info(shared_library_path, boost::dll::library_info::read_mode::memory_mapped);
+        BOOST_TEST(mapped_info.sections() == lib_info.sections());
+        BOOST_TEST(mapped_info.symbols() == lib_info.symbols());
+        BOOST_TEST(mapped_info.symbols("boostdll") == symb);
+        BOOST_TEST(mapped_info.symbols("section_that_does_not_exist").empty());
+        // Parsed headers are reused between the queries
+        BOOST_TEST(mapped_info.sections() == lib_info.sections());
+        BOOST_TEST(mapped_info.symbols("boostdll") == symb);
+        BOOST_TEST(mapped_info.has_symbol("say_hello"));
+        BOOST_TEST(!mapped_info.has_symbol("symbol_that_does_not_exist"));
+    }
+
+    // In memory binaries must provide the same info
+    {
+        std::ifstream ifs(shared_library_path.string(), std::ios::binary);
+        const std::vector<unsigned char> data{std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+        BOOST_TEST(!data.empty());
+
+        boost::dll::library_info buffer_info(data.data(), data.size());
+        BOOST_TEST(buffer_info.sections() == lib_info.sections());
+        BOOST_TEST(buffer_info.symbols() == lib_info.symbols());
+        BOOST_TEST(buffer_info.symbols("boostdll") == symb);
+
+        vector_reader reader(data);
+        boost::dll::library_info reader_info(reader);
+        BOOST_TEST(reader_info.sections() == lib_info.sections());
+        BOOST_TEST(reader_info.symbols() == lib_info.symbols());
+        BOOST_TEST(reader_info.symbols("boostdll") == symb);
+        BOOST_TEST(reader_info.has_symbol("say_hello"));
+
+#if !BOOST_OS_WINDOWS && !BOOST_OS_MACOS && !BOOST_OS_IOS
+        // Missing exported symbol is reported without reading the ".symtab"
+        if (std::find(sec.begin(), sec.end(), ".symtab") != sec.end()) {
+            reader.bytes_read = 0;
+            BOOST_TEST(!reader_info.has_symbol("symbol_that_does_not_exist"));
+            const std::uint64_t exported_bytes = reader.bytes_read;
+
+            reader.bytes_read = 0;
+            BOOST_TEST(!reader_info.has_symbol("symbol_that_does_not_exist", boost::dll::library_info::symbol_search::all));
+            BOOST_TEST_LT(exported_bytes, reader.bytes_read);
+        }
+#endif
+
+        const std::vector<unsigned char> garbage(128, 'x');
+        BOOST_TEST_THROWS(boost::dll::library_info(garbage.data(), garbage.size()), std::runtime_error);
+    }
+
     // Self testing
     std::cout << "Self: " << argv[0];
     boost::dll::library_info self_info(argv[0]);
@@ -74,6 +219,10 @@ int main(int argc, char* argv[])
         symb = stripped_lib.symbols();
         std::copy(symb.begin(), symb.end(), std::ostream_iterator<std::string>(std::cout, "\n"));
         BOOST_TEST(!symb.empty());
+        for (const std::string& name : symb) {
+            BOOST_TEST(stripped_lib.has_symbol(name));
+        }
+        BOOST_TEST(!stripped_lib.has_symbol("symbol_that_does_not_exist"));
     }
 
     return boost::report_errors();
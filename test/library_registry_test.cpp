@@ -0,0 +1,196 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/library_registry.hpp>
+#include <boost/dll/load_observer.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <string>
+#include <thread>
+
+// Unit Tests
+
+namespace {
+
+struct counting_observer: boost::dll::load_observer {
+    std::atomic<std::size_t> native_loads{0};
+
+    void on_event(const boost::dll::load_event& e) noexcept override {
+        native_loads += (e.phase == boost::dll::load_phase::native_load);
+    }
+};
+
+// Loads the same library through the registry from another thread, while the first load is in progress
+struct concurrent_load_observer: boost::dll::load_observer {
+    boost::dll::library_registry& registry;
+    const boost::dll::fs::path path;
+    std::atomic<bool> started{false};
+    std::atomic<bool> finished{false};
+    bool finished_during_load = false;
+    boost::dll::shared_library lib;
+    std::thread thread;
+
+    concurrent_load_observer(boost::dll::library_registry& r, const boost::dll::fs::path& p)
+        : registry(r), path(p)
+    {}
+
+    void on_event(const boost::dll::load_event& e) noexcept override {
+        if (e.phase != boost::dll::load_phase::native_load || !e.success || started.exchange(true)) {
+            return;
+        }
+
+        thread = std::thread([this]() {
+            lib = registry.load(path);
+            finished = true;
+        });
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (!finished && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        finished_during_load = finished;
+    }
+};
+
+}
+
+int main(int argc, char* argv[]) {
+    using namespace boost::dll;
+
+    const boost::dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+
+    BOOST_TEST_EQ(&library_registry::global(), &library_registry::global());
+
+    library_registry registry;
+    BOOST_TEST(registry.loaded_libraries().empty());
+
+    const boost::dll::fs::path hard_link_path = shared_library_path.parent_path()
+        / ("hard_link_" + shared_library_path.filename().string());
+    boost::dll::fs::remove(hard_link_path);
+
+    {
+        shared_library lib1 = registry.load(shared_library_path);
+        shared_library lib2 = registry.load(shared_library_path);
+        BOOST_TEST(lib1.is_loaded());
+        BOOST_TEST(lib1 == lib2);
+        BOOST_TEST_EQ(lib1.get<int>("integer_g"), 100);
+
+        // Different spelling of the same path is served from the cache without loading
+        const boost::dll::fs::path other_path = shared_library_path.parent_path() / "." / shared_library_path.filename();
+        counting_observer observer;
+        set_load_observer(&observer);
+        shared_library lib3 = registry.load(other_path);
+        set_load_observer(nullptr);
+        BOOST_TEST(lib3 == lib1);
+        BOOST_TEST_EQ(observer.native_loads, 0u);
+
+        // Path that is not equivalent, but resolves to the same library
+        boost::dll::fs::create_hard_link(shared_library_path, hard_link_path);
+        shared_library lib4 = registry.load(hard_link_path);
+        BOOST_TEST(lib4 == lib1);
+        boost::dll::fs::remove(hard_link_path);
+
+        const std::vector<library_registry::library_entry> entries = registry.loaded_libraries();
+        BOOST_TEST_EQ(entries.size(), 1u);
+        if (!entries.empty()) {
+            BOOST_TEST(entries[0].native == lib1.native());
+            BOOST_TEST_EQ(entries[0].use_count, 4u);
+            BOOST_TEST_EQ(entries[0].requested_paths.size(), 2u);
+            BOOST_TEST(boost::dll::fs::equivalent(entries[0].location, shared_library_path));
+        }
+
+        BOOST_TEST_EQ(registry.release_unused(), 0u);
+    }
+
+    BOOST_TEST_EQ(registry.loaded_libraries().size(), 1u);
+    BOOST_TEST_EQ(registry.loaded_libraries()[0].use_count, 0u);
+    BOOST_TEST_EQ(registry.release_unused(), 1u);
+    BOOST_TEST(registry.loaded_libraries().empty());
+
+    {
+        std::error_code ec;
+        shared_library lib = registry.load(shared_library_path.parent_path() / "library_that_does_not_exist", ec);
+        BOOST_TEST(ec);
+        BOOST_TEST(!lib.is_loaded());
+        BOOST_TEST(registry.loaded_libraries().empty());
+
+        BOOST_TEST_THROWS(registry.load(shared_library_path.parent_path() / "library_that_does_not_exist"), std::exception);
+    }
+
+    registry.load(shared_library_path);
+    registry.clear();
+    BOOST_TEST(registry.loaded_libraries().empty());
+
+    {
+        concurrent_load_observer observer(registry, shared_library_path);
+        set_load_observer(&observer);
+        shared_library lib = registry.load(shared_library_path);
+        set_load_observer(nullptr);
+        observer.thread.join();
+
+        // Registry is not locked during the load, the second load of the same path reuses the first inserted entry
+        BOOST_TEST(observer.finished_during_load);
+        BOOST_TEST(lib == observer.lib);
+        const std::vector<library_registry::library_entry> entries = registry.loaded_libraries();
+        BOOST_TEST_EQ(entries.size(), 1u);
+        if (!entries.empty()) {
+            BOOST_TEST_EQ(entries[0].requested_paths.size(), 1u);
+            BOOST_TEST_EQ(entries[0].use_count, 2u);
+        }
+        registry.clear();
+    }
+
+    {
+        // Relative paths are resolved against the current directory of each load
+        const boost::dll::fs::path old_current = boost::dll::fs::current_path();
+        const boost::dll::fs::path dir = boost::dll::fs::temp_directory_path()
+            / ("boost_dll_library_registry_test_" + std::to_string(static_cast<unsigned long long>(std::time(nullptr))));
+        boost::dll::fs::create_directories(dir / "with_library");
+        boost::dll::fs::create_directories(dir / "empty");
+        boost::dll::fs::copy_file(shared_library_path, dir / "with_library" / shared_library_path.filename());
+        const boost::dll::fs::path relative_path = shared_library_path.filename();
+
+        counting_observer observer;
+        set_load_observer(&observer);
+        boost::dll::fs::current_path(dir / "with_library");
+        shared_library lib1 = registry.load(relative_path);
+        BOOST_TEST(lib1 == registry.load(relative_path));
+        const std::size_t loads_in_same_directory = observer.native_loads;
+
+        boost::dll::fs::current_path(dir / "empty");
+        std::error_code direct_ec;
+        shared_library direct(relative_path, direct_ec);
+        observer.native_loads = 0;
+        std::error_code registry_ec;
+        shared_library lib2 = registry.load(relative_path, registry_ec);
+        const std::size_t loads_in_other_directory = observer.native_loads;
+        boost::dll::fs::current_path(old_current);
+        set_load_observer(nullptr);
+
+        BOOST_TEST(lib1.is_loaded());
+        BOOST_TEST_EQ(loads_in_same_directory, 1u);
+        BOOST_TEST(loads_in_other_directory > 0u);
+        // Same result as without the registry
+        BOOST_TEST_EQ(!!registry_ec, !!direct_ec);
+        BOOST_TEST(lib2 == direct);
+
+        registry.clear();
+        lib1.unload();
+        lib2.unload();
+        direct.unload();
+        boost::dll::fs::remove_all(dir);
+    }
+
+    return boost::report_errors();
+}
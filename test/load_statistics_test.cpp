@@ -0,0 +1,151 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/load_statistics.hpp>
+#include <boost/dll/shared_library.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <string>
+#include <vector>
+
+// Unit Tests
+
+struct recording_observer: boost::dll::load_observer {
+    std::vector<boost::dll::load_phase> phases;
+    std::vector<std::string> symbols;
+
+    void on_event(const boost::dll::load_event& e) noexcept override {
+        phases.push_back(e.phase);
+        if (e.symbol) {
+            symbols.push_back(e.symbol);
+        }
+    }
+};
+
+int main(int argc, char* argv[]) {
+    using namespace boost::dll;
+
+    const boost::dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+
+    BOOST_TEST(!get_load_observer());
+
+    {
+        recording_observer observer;
+        BOOST_TEST(!set_load_observer(&observer));
+        BOOST_TEST_EQ(get_load_observer(), &observer);
+
+        {
+            shared_library lib(shared_library_path);
+            BOOST_TEST(lib.has("integer_g"));
+            BOOST_TEST(lib.has("integer_g")); // cached
+        }
+        BOOST_TEST_EQ(set_load_observer(nullptr), &observer);
+
+        BOOST_TEST_EQ(observer.phases.size(), 4u);
+        if (observer.phases.size() == 4) {
+            BOOST_TEST(observer.phases[0] == load_phase::path_resolution);
+            BOOST_TEST(observer.phases[1] == load_phase::native_load);
+            BOOST_TEST(observer.phases[2] == load_phase::symbol_lookup);
+            BOOST_TEST(observer.phases[3] == load_phase::unload);
+        }
+        BOOST_TEST(observer.symbols == std::vector<std::string>{"integer_g"});
+    }
+
+    {
+        load_statistics stats;
+        set_load_observer(&stats);
+        {
+            shared_library lib(shared_library_path);
+            lib.get<int>("integer_g");
+            lib.has("symbol_that_does_not_exist");
+
+            std::error_code ec;
+            shared_library missing(shared_library_path.parent_path() / "library_that_does_not_exist", ec);
+            BOOST_TEST(ec);
+        }
+        set_load_observer(nullptr);
+
+        const std::vector<load_statistics::library_statistics> libs = stats.snapshot();
+        BOOST_TEST_EQ(libs.size(), 2u);
+
+        bool found = false;
+        for (const load_statistics::library_statistics& lib : libs) {
+            if (lib.library.filename() != shared_library_path.filename()) {
+                BOOST_TEST_EQ(lib[load_phase::native_load].failures, lib[load_phase::native_load].count);
+                continue;
+            }
+
+            found = true;
+            const load_statistics::histogram& load = lib[load_phase::native_load];
+            BOOST_TEST_EQ(load.count, 1u);
+            BOOST_TEST_EQ(load.failures, 0u);
+            BOOST_TEST(load.min_ns <= load.max_ns);
+            BOOST_TEST_EQ(load.buckets[load_statistics::histogram::bucket_index(load.max_ns)], 1u);
+
+            BOOST_TEST_EQ(lib[load_phase::symbol_lookup].count, 2u);
+            BOOST_TEST_EQ(lib[load_phase::symbol_lookup].failures, 1u);
+            BOOST_TEST_EQ(lib[load_phase::unload].count, 1u);
+        }
+        BOOST_TEST(found);
+
+        stats.reset();
+        BOOST_TEST(stats.snapshot().empty());
+    }
+
+    {
+        recording_observer observer;
+        set_load_observer(&observer);
+        {
+            // Decorations do not match the full file name, so the undecorated path is loaded
+            shared_library lib(shared_library_path, load_mode::append_decorations);
+            BOOST_TEST(lib);
+        }
+        set_load_observer(nullptr);
+
+        std::size_t resolutions = 0;
+        for (load_phase phase : observer.phases) {
+            resolutions += (phase == load_phase::path_resolution);
+        }
+        BOOST_TEST_EQ(resolutions, 1u);
+    }
+
+    {
+        load_statistics stats;
+        set_load_observer(&stats);
+        {
+            // Both loads share the native handle, unloading one of them keeps the path of the other
+            shared_library lib1(shared_library_path);
+            shared_library lib2(shared_library_path);
+            BOOST_TEST_EQ(lib1.native(), lib2.native());
+            lib1.unload();
+            BOOST_TEST(lib2.has("integer_g"));
+        }
+        set_load_observer(nullptr);
+
+        const std::vector<load_statistics::library_statistics> libs = stats.snapshot();
+        BOOST_TEST_EQ(libs.size(), 1u);
+        if (libs.size() == 1) {
+            BOOST_TEST_EQ(libs.front().library, shared_library_path);
+            BOOST_TEST_EQ(libs.front()[load_phase::native_load].count, 2u);
+            BOOST_TEST_EQ(libs.front()[load_phase::symbol_lookup].count, 1u);
+            BOOST_TEST_EQ(libs.front()[load_phase::unload].count, 2u);
+        }
+    }
+
+    BOOST_TEST_EQ(load_statistics::histogram::bucket_index(0), 0u);
+    BOOST_TEST_EQ(load_statistics::histogram::bucket_index(1), 0u);
+    BOOST_TEST_EQ(load_statistics::histogram::bucket_index(2), 1u);
+    BOOST_TEST_EQ(load_statistics::histogram::bucket_index(1023), 9u);
+    BOOST_TEST_EQ(load_statistics::histogram::bucket_index(1024), 10u);
+    BOOST_TEST_EQ(load_statistics::histogram::bucket_index(~0ull), load_statistics::histogram::buckets_count - 1);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,61 @@
+// Copyright Antony Polukhin, 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/loaded_library_info.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+// Unit Tests
+
+#include <algorithm>
+#include <iterator>
+
+int main(int argc, char* argv[])
+{
+    boost::dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+
+    boost::dll::shared_library lib(shared_library_path);
+    boost::dll::loaded_library_info loaded_info(lib);
+
+#if BOOST_OS_WINDOWS || (!BOOST_OS_MACOS && !BOOST_OS_IOS && !BOOST_OS_ANDROID && !BOOST_OS_QNX && !BOOST_OS_CYGWIN)
+    BOOST_TEST(loaded_info.from_memory());
+#endif
+
+    std::vector<std::string> symb = loaded_info.symbols();
+    std::copy(symb.begin(), symb.end(), std::ostream_iterator<std::string>(std::cout, "\n"));
+    BOOST_TEST(std::find(symb.begin(), symb.end(), "const_integer_g") != symb.end());
+    BOOST_TEST(std::find(symb.begin(), symb.end(), "say_hello") != symb.end());
+    BOOST_TEST(std::find(symb.begin(), symb.end(), "const_integer_g_alias") != symb.end());
+
+    // All the exported symbols are also reported by the library_info and could be loaded
+    const std::vector<std::string> file_symb = boost::dll::library_info(shared_library_path).symbols();
+    for (const std::string& name : symb) {
+        BOOST_TEST(std::find(file_symb.begin(), file_symb.end(), name) != file_symb.end());
+        BOOST_TEST(lib.has(name));
+    }
+
+    std::size_t calls = 0;
+    loaded_info.for_each_symbol([&calls](boost::core::string_view) {
+        ++calls;
+        return false;
+    });
+    BOOST_TEST_EQ(calls, 1u);
+
+    std::vector<std::string> visited;
+    loaded_info.for_each_symbol([&visited](boost::core::string_view name) {
+        visited.emplace_back(name.data(), name.size());
+    });
+    BOOST_TEST(visited == symb);
+
+    boost::dll::shared_library empty;
+    BOOST_TEST_THROWS(boost::dll::loaded_library_info{empty}, boost::dll::fs::system_error);
+
+    return boost::report_errors();
+}
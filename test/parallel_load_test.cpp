@@ -0,0 +1,61 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/parallel_load.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <iostream>
+
+// Unit Tests
+
+int main(int argc, char* argv[]) {
+    using namespace boost::dll;
+
+    const boost::dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+    const boost::dll::fs::path missing_path = shared_library_path.parent_path() / "library_that_does_not_exist";
+
+    {
+        const std::vector<parallel_load_result> results = parallel_load({missing_path, shared_library_path, shared_library_path}, load_mode::default_mode, 2);
+        BOOST_TEST_EQ(results.size(), 3u);
+        for (const parallel_load_result& r : results) {
+            std::cout << r.path << ": order " << r.load_order << ", prefetch " << r.prefetch_time.count()
+                << "ns, load " << r.load_time.count() << "ns, error '" << r.error.message() << "'\n";
+        }
+
+        BOOST_TEST(results[0].error);
+        BOOST_TEST(!results[0].library.is_loaded());
+        BOOST_TEST(results[0].dependencies.empty());
+
+        BOOST_TEST(!results[1].error);
+        BOOST_TEST(results[1].library.has("integer_g"));
+        BOOST_TEST(!results[1].dependencies.empty());
+        BOOST_TEST(results[1].library == results[2].library);
+
+        BOOST_TEST_EQ(results[0].load_order + results[1].load_order + results[2].load_order, 3u);
+    }
+
+    BOOST_TEST(parallel_load({}).empty());
+
+    {
+        // libc.so <- liba.so <- libb.so, libd.so and libe.so depend on each other
+        std::vector<parallel_load_result> results(5);
+        results[0].path = "/plugins/libb.so";  results[0].dependencies = {"liba.so", "libc.so.6"};
+        results[1].path = "/plugins/libd.so";  results[1].dependencies = {"libe.so"};
+        results[2].path = "/plugins/liba.so";  results[2].dependencies = {"/plugins/libc.so"};
+        results[3].path = "/plugins/libc.so";
+        results[4].path = "/plugins/libe.so";  results[4].dependencies = {"libd.so"};
+
+        const std::vector<std::size_t> expected = {3, 2, 0, 1, 4};
+        BOOST_TEST(boost::dll::detail::load_sequence(results) == expected);
+    }
+
+    return boost::report_errors();
+}
@@ -10,6 +10,7 @@
 
 #include "../example/b2_workarounds.hpp"
 #include <boost/dll.hpp>
+#include <boost/dll/bound_symbol.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include <functional>
 #include <memory>
@@ -35,6 +36,47 @@ void refcountable_test(boost::dll::fs::path shared_library_path) {
 
     std::vector<int> v(1000);
 
+    {
+        shared_library copy;
+        {
+            shared_library sl(shared_library_path);
+            sl.get<int>("integer_g") = 42;
+
+            copy = sl;
+            BOOST_TEST(copy == sl);
+
+            shared_library copy2(sl);
+            BOOST_TEST(copy2 == sl);
+            copy2 = copy;
+            BOOST_TEST(copy2 == sl);
+        }
+
+        // Library stays loaded while at least one copy exists
+        BOOST_TEST(copy.is_loaded());
+        BOOST_TEST_EQ(copy.get<int>("integer_g"), 42);
+        copy.get<int>("integer_g") = 100;
+
+        shared_library moved(std::move(copy));
+        BOOST_TEST(!copy.is_loaded());
+        BOOST_TEST(moved.has("integer_g"));
+    }
+
+    {
+        // Imports share the library of the source shared_library
+        shared_library sl(shared_library_path);
+        auto inc = import_symbol<int(int)>(sl, "increment");
+        auto ver = import_symbol<lib_version_func>(sl, std::string("lib_version"));
+        auto sz = import_alias<std::size_t(const std::vector<int>&)>(shared_library(sl), "foo_bar");
+        sl.unload();
+
+        BOOST_TEST_EQ(inc(1), 2);
+        BOOST_TEST_EQ(ver(), 1.0f);
+        BOOST_TEST_EQ(sz(v), 1000u);
+
+        auto inc_copy = inc;
+        BOOST_TEST_EQ(inc_copy(2), 3);
+    }
+
     {
         std::function<say_hello_func> sz2
             = import_symbol<say_hello_func>(shared_library_path, "say_hello");
@@ -124,6 +166,13 @@ void refcountable_test(boost::dll::fs::path shared_library_path) {
     }
 }
 
+struct test_library_api {
+    int (*increment)(int);
+    void (*say_hello)();
+    int* integer_g;
+    const int* const_integer_g;
+};
+
 // exe function
 extern "C" int BOOST_SYMBOL_EXPORT exef() {
     return 15;
@@ -139,6 +188,32 @@ int main(int argc, char* argv[]) {
 
     refcountable_test(shared_library_path);
 
+    {
+        // Program handle looks up the symbols in the global scope, results must not outlive the libraries
+        shared_library self(program_location());
+        {
+            shared_library global_lib(shared_library_path, load_mode::rtld_lazy | load_mode::rtld_global);
+#if !BOOST_OS_WINDOWS
+            BOOST_TEST(self.has("integer_g"));
+            BOOST_TEST_EQ(&self.get<int>("integer_g"), &global_lib.get<int>("integer_g"));
+#endif
+        }
+        BOOST_TEST(!self.has("integer_g"));
+        BOOST_TEST_THROWS(self.get<int>("integer_g"), std::exception);
+    }
+
+#if !BOOST_OS_WINDOWS
+    {
+        // Same for the adopted handle of the program
+        shared_library self(dlopen(nullptr, RTLD_LAZY));
+        {
+            shared_library global_lib(shared_library_path, load_mode::rtld_lazy | load_mode::rtld_global);
+            BOOST_TEST(self.has("integer_g"));
+        }
+        BOOST_TEST(!self.has("integer_g"));
+    }
+#endif
+
     shared_library sl(shared_library_path);
 
     BOOST_TEST(sl.get<int>("integer_g") == 100);
@@ -169,6 +244,66 @@ int main(int argc, char* argv[]) {
     BOOST_TEST(inc(1) == 2);
     BOOST_TEST(sl.get<int>("integer_g") == 10);
 
+    // Cached and bound symbols
+    BOOST_TEST_EQ(&sl.get<int>("integer_g"), &sl.get<int>("integer_g"));
+    BOOST_TEST(!sl.has("symbol_that_does_not_exist"));
+    BOOST_TEST(!sl.has("symbol_that_does_not_exist"));
+    {
+        bound_symbol<int(int)> bound_inc(sl, "increment");
+        bound_symbol<int> bound_integer(sl, std::string("integer_g"));
+        BOOST_TEST(bound_inc);
+        BOOST_TEST(bound_inc.library() == sl);
+        BOOST_TEST_EQ(bound_integer.get(), &sl.get<int>("integer_g"));
+
+        shared_library copy = sl;
+        copy.unload();
+        BOOST_TEST_EQ(bound_inc(1), 2);
+        BOOST_TEST_EQ(*bound_integer, 10);
+
+        BOOST_TEST(!bound_symbol<int>());
+        BOOST_TEST_THROWS(bound_symbol<int>(sl, "symbol_that_does_not_exist"), std::exception);
+        BOOST_TEST_THROWS(bound_symbol<int>(shared_library(), "integer_g"), std::exception);
+    }
+
+
+    // Batch resolution
+    {
+        test_library_api api = {};
+        sl.get_all(api,
+            make_symbol_member(&test_library_api::increment, "increment"),
+            make_symbol_member(&test_library_api::say_hello, "say_hello"),
+            make_symbol_member(&test_library_api::integer_g, "integer_g"),
+            make_symbol_member(&test_library_api::const_integer_g, "const_integer_g")
+        );
+        BOOST_TEST_EQ(api.increment(1), 2);
+        BOOST_TEST(api.say_hello == &sl.get<say_hello_func>("say_hello"));
+        BOOST_TEST_EQ(api.integer_g, &sl.get<int>("integer_g"));
+        BOOST_TEST_EQ(*api.const_integer_g, 777);
+
+        test_library_api partial = {};
+        std::error_code ec;
+        const std::vector<std::string> missing = sl.get_all(partial, ec,
+            make_symbol_member(&test_library_api::increment, "increment"),
+            make_symbol_member(&test_library_api::say_hello, "missing_function"),
+            make_symbol_member(&test_library_api::integer_g, "missing_variable")
+        );
+        BOOST_TEST(ec);
+        BOOST_TEST_EQ(missing.size(), 2u);
+        BOOST_TEST(!partial.increment);
+        if (missing.size() == 2) {
+            BOOST_TEST_EQ(missing[0], "missing_function");
+            BOOST_TEST_EQ(missing[1], "missing_variable");
+        }
+
+        BOOST_TEST_THROWS(
+            sl.get_all(partial, make_symbol_member(&test_library_api::integer_g, "missing_variable")),
+            std::exception
+        );
+        BOOST_TEST_THROWS(
+            shared_library().get_all(partial, make_symbol_member(&test_library_api::integer_g, "integer_g")),
+            std::exception
+        );
+    }
 
     // Checking aliases
     std::function<std::size_t(const std::vector<int>&)> sz 
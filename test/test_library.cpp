@@ -104,6 +104,22 @@ int protected_function(int) {
 #endif
 
 
+#include <boost/dll/interface_table.hpp>
+
+// Must be the same as in interface_table_test.cpp
+struct test_library_table {
+    int (*increment)(int);
+    float (*lib_version)();
+    int* integer;
+};
+
+namespace table_api {
+    const test_library_table table = { &increment, &lib_version, &integer_g };
+}
+
+BOOST_DLL_INTERFACE_TABLE(table_api::table, test_library_table_v1)
+
+
 #include <boost/dll/runtime_symbol_info.hpp>
 
 boost::dll::fs::path this_module_location_from_itself() {